@@ -4,8 +4,89 @@
 #       (See accompanying file LICENSE_1_0.txt or copy at
 #           http://www.boost.org/LICENSE_1_0.txt)
 
+# ------------------------------------------------------------------------------
+# Code size report (internal)
+#
+# When this file is run in script mode with SIMDPP_CODE_SIZE_ARCHIVE defined,
+# it writes the size of the code compiled for each architecture in the given
+# static library to SIMDPP_CODE_SIZE_OUTPUT and to the standard output. The
+# sizes are retrieved by running SIMDPP_CODE_SIZE_TOOL, which must produce
+# the output in the format of the Berkeley size tool. The object files are
+# attributed to the architectures according to the suffixes added by
+# simdpp_multiarch. This is used by simdpp_add_dispatched_library.
+if(CMAKE_SCRIPT_MODE_FILE AND DEFINED SIMDPP_CODE_SIZE_ARCHIVE)
+    execute_process(COMMAND "${SIMDPP_CODE_SIZE_TOOL}" "${SIMDPP_CODE_SIZE_ARCHIVE}"
+                    OUTPUT_VARIABLE SIZE_OUTPUT
+                    RESULT_VARIABLE SIZE_RESULT)
+    if(NOT "${SIZE_RESULT}" STREQUAL "0")
+        message(WARNING "Could not retrieve the code size of ${SIMDPP_CODE_SIZE_ARCHIVE}")
+        return()
+    endif()
+
+    set(ARCH_NAMES "")
+    set(TOTAL_TEXT 0)
+    set(TOTAL_DATA 0)
+    string(REPLACE "\n" ";" SIZE_LINES "${SIZE_OUTPUT}")
+    foreach(LINE ${SIZE_LINES})
+        if("${LINE}" MATCHES "^[ \t]*([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]+[0-9]+[ \t]+[0-9a-fA-F]+[ \t]+(.*)$")
+            set(TEXT "${CMAKE_MATCH_1}")
+            math(EXPR DATA "${CMAKE_MATCH_2} + ${CMAKE_MATCH_3}")
+            set(FILE "${CMAKE_MATCH_4}")
+            if("${FILE}" MATCHES "_simdpp_-([^.]*)\\.")
+                string(REPLACE "-" "," ARCH_NAME "${CMAKE_MATCH_1}")
+            else()
+                set(ARCH_NAME "common")
+            endif()
+            list(FIND ARCH_NAMES "${ARCH_NAME}" FOUND)
+            if(${FOUND} EQUAL -1)
+                list(APPEND ARCH_NAMES "${ARCH_NAME}")
+                set(TEXT_${ARCH_NAME} 0)
+                set(DATA_${ARCH_NAME} 0)
+            endif()
+            math(EXPR TEXT_${ARCH_NAME} "${TEXT_${ARCH_NAME}} + ${TEXT}")
+            math(EXPR DATA_${ARCH_NAME} "${DATA_${ARCH_NAME}} + ${DATA}")
+            math(EXPR TOTAL_TEXT "${TOTAL_TEXT} + ${TEXT}")
+            math(EXPR TOTAL_DATA "${TOTAL_DATA} + ${DATA}")
+        endif()
+    endforeach()
+
+    get_filename_component(ARCHIVE_NAME "${SIMDPP_CODE_SIZE_ARCHIVE}" NAME)
+    set(REPORT "Code size of ${ARCHIVE_NAME} per architecture (bytes):\n")
+    set(REPORT "${REPORT}      text       data  arch\n")
+    list(SORT ARCH_NAMES)
+    foreach(ARCH_NAME ${ARCH_NAMES} total)
+        if("${ARCH_NAME}" STREQUAL "total")
+            set(TEXT "${TOTAL_TEXT}")
+            set(DATA "${TOTAL_DATA}")
+        else()
+            set(TEXT "${TEXT_${ARCH_NAME}}")
+            set(DATA "${DATA_${ARCH_NAME}}")
+        endif()
+        # right-align the numbers
+        set(SPACES "                    ")
+        string(LENGTH "${TEXT}" TEXT_LEN)
+        string(LENGTH "${DATA}" DATA_LEN)
+        math(EXPR TEXT_PAD "10 - ${TEXT_LEN}")
+        math(EXPR DATA_PAD "11 - ${DATA_LEN}")
+        if(${TEXT_PAD} LESS 0)
+            set(TEXT_PAD 0)
+        endif()
+        if(${DATA_PAD} LESS 1)
+            set(DATA_PAD 1)
+        endif()
+        string(SUBSTRING "${SPACES}" 0 ${TEXT_PAD} TEXT_PADDING)
+        string(SUBSTRING "${SPACES}" 0 ${DATA_PAD} DATA_PADDING)
+        set(REPORT "${REPORT}${TEXT_PADDING}${TEXT}${DATA_PADDING}${DATA}  ${ARCH_NAME}\n")
+    endforeach()
+
+    file(WRITE "${SIMDPP_CODE_SIZE_OUTPUT}" "${REPORT}")
+    message("${REPORT}")
+    return()
+endif()
+
 include(CheckCXXSourceRuns)
 include(CheckCXXSourceCompiles)
+include(CMakeParseArguments)
 
 # ------------------------------------------------------------------------------
 # Compiler checks (internal)
@@ -683,6 +764,579 @@ set(SIMDPP_X86_AVX512VL_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_PCLMULQDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_PCLMULQDQ_CXX_FLAGS "-msse2 -mpclmul")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_PCLMULQDQ_CXX_FLAGS "/arch:SSE2")
+endif()
+set(SIMDPP_X86_PCLMULQDQ_DEFINE "SIMDPP_ARCH_X86_PCLMULQDQ")
+set(SIMDPP_X86_PCLMULQDQ_SUFFIX "-x86_pclmul")
+set(SIMDPP_X86_PCLMULQDQ_TEST_CODE
+    "#include <wmmintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i one = _mm_load_si128((__m128i*)p);
+        one = _mm_clmulepi64_si128(one, one, 0x01);
+        _mm_store_si128((__m128i*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_VPCLMULQDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_VPCLMULQDQ_CXX_FLAGS "-mavx2 -mpclmul -mvpclmulqdq")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_VPCLMULQDQ_CXX_FLAGS "/arch:AVX2")
+endif()
+set(SIMDPP_X86_VPCLMULQDQ_DEFINE "SIMDPP_ARCH_X86_VPCLMULQDQ")
+set(SIMDPP_X86_VPCLMULQDQ_SUFFIX "-x86_vpclmul")
+set(SIMDPP_X86_VPCLMULQDQ_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m256i one = _mm256_load_si256((__m256i*)p);
+        one = _mm256_clmulepi64_epi128(one, one, 0x01);
+        _mm256_store_si256((__m256i*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI1")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_BMI1_CXX_FLAGS "-msse2 -mbmi")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_BMI1_CXX_FLAGS "/arch:SSE2")
+endif()
+set(SIMDPP_X86_BMI1_DEFINE "SIMDPP_ARCH_X86_BMI1")
+set(SIMDPP_X86_BMI1_SUFFIX "-x86_bmi1")
+set(SIMDPP_X86_BMI1_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        unsigned* u = (unsigned*)p;
+        u[0] = _blsr_u32(u[0]);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_BMI2_CXX_FLAGS "-msse2 -mbmi2")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_BMI2_CXX_FLAGS "/arch:SSE2")
+endif()
+set(SIMDPP_X86_BMI2_DEFINE "SIMDPP_ARCH_X86_BMI2")
+set(SIMDPP_X86_BMI2_SUFFIX "-x86_bmi2")
+set(SIMDPP_X86_BMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        unsigned* u = (unsigned*)p;
+        u[0] = _pdep_u32(u[0], u[1]);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_F16C")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "-mavx -mf16c")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "/arch:AVX")
+endif()
+set(SIMDPP_X86_F16C_DEFINE "SIMDPP_ARCH_X86_F16C")
+set(SIMDPP_X86_F16C_SUFFIX "-x86_f16c")
+set(SIMDPP_X86_F16C_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128 f = _mm_load_ps((float*)p);
+        __m128i h = _mm_cvtps_ph(f, 0);
+        _mm_store_si128((__m128i*)p, h);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI_CXX_FLAGS "-mavx512f -mavx512bw -mavx512vbmi")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVX512VBMI_CXX_FLAGS "/arch:AVX512")
+endif()
+set(SIMDPP_X86_AVX512VBMI_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI")
+set(SIMDPP_X86_AVX512VBMI_SUFFIX "-x86_avx512vbmi")
+set(SIMDPP_X86_AVX512VBMI_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i one = _mm512_load_si512((void*)p);
+        one = _mm512_permutexvar_epi8(one, one);
+        _mm512_store_si512((void*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI2_CXX_FLAGS "-mavx512f -mavx512bw -mavx512vbmi2")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVX512VBMI2_CXX_FLAGS "/arch:AVX512")
+endif()
+set(SIMDPP_X86_AVX512VBMI2_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI2")
+set(SIMDPP_X86_AVX512VBMI2_SUFFIX "-x86_avx512vbmi2")
+set(SIMDPP_X86_AVX512VBMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i one = _mm512_load_si512((void*)p);
+        one = _mm512_shldi_epi16(one, one, 3);
+        _mm512_store_si512((void*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VNNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VNNI_CXX_FLAGS "-mavx512f -mavx512vnni")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVX512VNNI_CXX_FLAGS "/arch:AVX512")
+endif()
+set(SIMDPP_X86_AVX512VNNI_DEFINE "SIMDPP_ARCH_X86_AVX512VNNI")
+set(SIMDPP_X86_AVX512VNNI_SUFFIX "-x86_avx512vnni")
+set(SIMDPP_X86_AVX512VNNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i one = _mm512_load_si512((void*)p);
+        one = _mm512_dpbusd_epi32(one, one, one);
+        _mm512_store_si512((void*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512BITALG")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512BITALG_CXX_FLAGS "-mavx512f -mavx512bw -mavx512bitalg")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVX512BITALG_CXX_FLAGS "/arch:AVX512")
+endif()
+set(SIMDPP_X86_AVX512BITALG_DEFINE "SIMDPP_ARCH_X86_AVX512BITALG")
+set(SIMDPP_X86_AVX512BITALG_SUFFIX "-x86_avx512bitalg")
+set(SIMDPP_X86_AVX512BITALG_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i one = _mm512_load_si512((void*)p);
+        one = _mm512_popcnt_epi8(one);
+        _mm512_store_si512((void*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VPOPCNTDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VPOPCNTDQ_CXX_FLAGS "-mavx512f -mavx512vpopcntdq")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVX512VPOPCNTDQ_CXX_FLAGS "/arch:AVX512")
+endif()
+set(SIMDPP_X86_AVX512VPOPCNTDQ_DEFINE "SIMDPP_ARCH_X86_AVX512VPOPCNTDQ")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_SUFFIX "-x86_avx512vpopcntdq")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i one = _mm512_load_si512((void*)p);
+        one = _mm512_popcnt_epi64(one);
+        _mm512_store_si512((void*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512BF16")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512BF16_CXX_FLAGS "-mavx512f -mavx512bw -mavx512bf16")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVX512BF16_CXX_FLAGS "/arch:AVX512")
+endif()
+set(SIMDPP_X86_AVX512BF16_DEFINE "SIMDPP_ARCH_X86_AVX512BF16")
+set(SIMDPP_X86_AVX512BF16_SUFFIX "-x86_avx512bf16")
+set(SIMDPP_X86_AVX512BF16_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512 f = _mm512_load_ps((float*)p);
+        __m512bh h = _mm512_cvtne2ps_pbh(f, f);
+        f = _mm512_dpbf16_ps(f, h, h);
+        _mm512_store_ps((float*)p, f);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512FP16")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512FP16_CXX_FLAGS "-mavx512f -mavx512bw -mavx512dq -mavx512vl -mavx512fp16")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVX512FP16_CXX_FLAGS "/arch:AVX512")
+endif()
+set(SIMDPP_X86_AVX512FP16_DEFINE "SIMDPP_ARCH_X86_AVX512FP16")
+set(SIMDPP_X86_AVX512FP16_SUFFIX "-x86_avx512fp16")
+set(SIMDPP_X86_AVX512FP16_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512h h = _mm512_castsi512_ph(_mm512_load_si512((void*)p));
+        h = _mm512_add_ph(h, h);
+        _mm512_store_si512((void*)p, _mm512_castph_si512(h));
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVXVNNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVXVNNI_CXX_FLAGS "-mavx2 -mavxvnni")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_AVXVNNI_CXX_FLAGS "/arch:AVX2")
+endif()
+set(SIMDPP_X86_AVXVNNI_DEFINE "SIMDPP_ARCH_X86_AVXVNNI")
+set(SIMDPP_X86_AVXVNNI_SUFFIX "-x86_avxvnni")
+set(SIMDPP_X86_AVXVNNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m256i one = _mm256_load_si256((__m256i*)p);
+        one = _mm256_dpbusd_avx_epi32(one, one, one);
+        _mm256_store_si256((__m256i*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_GFNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_GFNI_CXX_FLAGS "-msse2 -mgfni")
+elseif(SIMDPP_MSVC OR SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_GFNI_CXX_FLAGS "/arch:SSE2")
+endif()
+set(SIMDPP_X86_GFNI_DEFINE "SIMDPP_ARCH_X86_GFNI")
+set(SIMDPP_X86_GFNI_SUFFIX "-x86_gfni")
+set(SIMDPP_X86_GFNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i one = _mm_load_si128((__m128i*)p);
+        one = _mm_gf2p8mul_epi8(one, one);
+        _mm_store_si128((__m128i*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon")
@@ -1035,6 +1689,9 @@ endfunction()
 #   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1,
 #   X86_AVX, X86_AVX2, X86_FMA3, X86_FMA4,
 #   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_XOP,
+#   X86_PCLMULQDQ, X86_VPCLMULQDQ, X86_BMI1, X86_BMI2, X86_F16C,
+#   X86_AVX512VBMI, X86_AVX512VBMI2, X86_AVX512VNNI, X86_AVX512BITALG,
+#   X86_AVX512VPOPCNTDQ, X86_AVX512BF16, X86_AVX512FP16, X86_AVXVNNI, X86_GFNI,
 #   ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON,
 #   MIPS_MSA, POWER_ALTIVEC, POWER_VSX_206, POWER_VSX_207
 #
@@ -1100,6 +1757,95 @@ function(simdpp_multiarch FILE_LIST_VAR SRC_FILE)
     set(${FILE_LIST_VAR} ${RECV_FILE_LIST} PARENT_SCOPE)
 endfunction()
 
+# The path to this file. Used to run the code size report in script mode.
+set(SIMDPP_MULTIARCH_CMAKE_FILE "${CMAKE_CURRENT_LIST_FILE}")
+
+# ------------------------------------------------------------------------------
+#
+# simdpp_add_dispatched_library(TARGET
+#                               ARCHS ARCH...
+#                               SOURCES SRC_FILE...
+#                               [EXCLUDE_FROM_ALL]
+#                               [NO_CODE_SIZE_REPORT])
+#
+# Creates a static library @a TARGET out of multi-architecture source files.
+# Each source file is compiled once for each supplied architecture definition
+# as if by simdpp_multiarch. The dispatchers defined in each source file are
+# emitted into one of its copies, so that the library contains all versions
+# of the dispatched functions together with the dispatchers and nothing
+# else needs to be generated by the user.
+#
+# Unless NO_CODE_SIZE_REPORT is given, the size of the code compiled for each
+# architecture is reported after the library is built. The report is printed
+# and written to ${TARGET}_code_size.txt in the current binary directory. The
+# report needs the Berkeley size tool, e.g. size or llvm-size, and is skipped
+# if the tool is not found.
+#
+# The compile flags, include directories and definitions of the library can be
+# adjusted with the usual commands, e.g. set_target_properties and
+# target_compile_definitions.
+#
+# Arguments:
+#
+# * TARGET: the name of the library target to create
+#
+# * ARCHS: a list of architecture definitions in the same format as accepted by
+#   simdpp_multiarch, e.g. the list returned by simdpp_get_compilable_archs
+#
+# * SOURCES: a list of source files relative to CMAKE_CURRENT_SOURCE_DIR
+#
+# * EXCLUDE_FROM_ALL: passed to add_library
+#
+# * NO_CODE_SIZE_REPORT: don't report the code size of each architecture
+#
+function(simdpp_add_dispatched_library TARGET)
+    cmake_parse_arguments(DISPATCHED "EXCLUDE_FROM_ALL;NO_CODE_SIZE_REPORT" ""
+                          "ARCHS;SOURCES" ${ARGN})
+    if("${DISPATCHED_ARCHS}" STREQUAL "")
+        message(FATAL_ERROR "No architectures given for \"${TARGET}\"")
+    endif()
+    if("${DISPATCHED_SOURCES}" STREQUAL "")
+        message(FATAL_ERROR "No source files given for \"${TARGET}\"")
+    endif()
+
+    set(GEN_SOURCES "")
+    foreach(SRC ${DISPATCHED_SOURCES})
+        simdpp_multiarch(GEN_SOURCES ${SRC} ${DISPATCHED_ARCHS})
+    endforeach()
+
+    if(DISPATCHED_EXCLUDE_FROM_ALL)
+        add_library(${TARGET} STATIC EXCLUDE_FROM_ALL ${GEN_SOURCES})
+    else()
+        add_library(${TARGET} STATIC ${GEN_SOURCES})
+    endif()
+
+    if(DISPATCHED_NO_CODE_SIZE_REPORT)
+        return()
+    endif()
+
+    # Prefer the size tool of the toolchain that creates the archive, e.g.
+    # aarch64-linux-gnu-size for aarch64-linux-gnu-ar
+    set(SIZE_NAMES "")
+    get_filename_component(AR_DIR "${CMAKE_AR}" PATH)
+    get_filename_component(AR_NAME "${CMAKE_AR}" NAME_WE)
+    if("${AR_NAME}" MATCHES "^(.+-)ar$")
+        list(APPEND SIZE_NAMES "${CMAKE_MATCH_1}size")
+    endif()
+    list(APPEND SIZE_NAMES size llvm-size)
+    find_program(SIMDPP_SIZE_EXECUTABLE NAMES ${SIZE_NAMES} HINTS "${AR_DIR}")
+    if(NOT SIMDPP_SIZE_EXECUTABLE)
+        return()
+    endif()
+
+    add_custom_command(TARGET ${TARGET} POST_BUILD
+                       COMMAND ${CMAKE_COMMAND}
+                           "-DSIMDPP_CODE_SIZE_TOOL=${SIMDPP_SIZE_EXECUTABLE}"
+                           "-DSIMDPP_CODE_SIZE_ARCHIVE=$<TARGET_FILE:${TARGET}>"
+                           "-DSIMDPP_CODE_SIZE_OUTPUT=${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_code_size.txt"
+                           -P "${SIMDPP_MULTIARCH_CMAKE_FILE}"
+                       VERBATIM)
+endfunction()
+
 # ------------------------------------------------------------------------------
 # Given a list of archs, return all possible permutations of them (internal)
 #
@@ -1188,10 +1934,38 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
                     # All Intel processors that support AVX512BW also support
                     # AVX512DQ and AVX512VL
                     list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL")
+
+                    if(DEFINED ARCH_SUPPORTED_X86_VPCLMULQDQ)
+                        # Since Ice Lake and Zen 4
+                        list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_PCLMULQDQ,X86_VPCLMULQDQ")
+
+                        if(DEFINED ARCH_SUPPORTED_X86_AVX512VBMI AND
+                                DEFINED ARCH_SUPPORTED_X86_AVX512VBMI2 AND
+                                DEFINED ARCH_SUPPORTED_X86_AVX512VNNI AND
+                                DEFINED ARCH_SUPPORTED_X86_AVX512BITALG AND
+                                DEFINED ARCH_SUPPORTED_X86_AVX512VPOPCNTDQ AND
+                                DEFINED ARCH_SUPPORTED_X86_GFNI AND
+                                DEFINED ARCH_SUPPORTED_X86_BMI1 AND
+                                DEFINED ARCH_SUPPORTED_X86_BMI2 AND
+                                DEFINED ARCH_SUPPORTED_X86_F16C)
+                            # All Ice Lake and Zen 4 CPUs support these
+                            list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_PCLMULQDQ,X86_VPCLMULQDQ,X86_AVX512VBMI,X86_AVX512VBMI2,X86_AVX512VNNI,X86_AVX512BITALG,X86_AVX512VPOPCNTDQ,X86_GFNI,X86_BMI1,X86_BMI2,X86_F16C")
+                        endif()
+                    endif()
                 endif()
             endif()
         endif()
     endif()
+    if(DEFINED ARCH_SUPPORTED_X86_PCLMULQDQ)
+        # Since Westmere, Bulldozer, Jaguar
+        # Almost all CPUs that support AVX also support PCLMULQDQ. The
+        # existing configs are kept as is so that the instruction sets they
+        # require do not change, and a separate AVX2 config with PCLMULQDQ
+        # is added instead.
+        if(DEFINED ARCH_SUPPORTED_X86_AVX2 AND DEFINED ARCH_SUPPORTED_X86_FMA3)
+            list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_PCLMULQDQ")
+        endif()
+    endif()
     if(DEFINED ARCH_SUPPORTED_X86_XOP)
         list(APPEND ALL_ARCHS "X86_XOP")
         if(DEFINED ARCH_SUPPORTED_X86_AVX)
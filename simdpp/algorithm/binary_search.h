@@ -0,0 +1,304 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_BINARY_SEARCH_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_BINARY_SEARCH_H
+
+#include <simdpp/simd.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+template<class T> struct search_vec;
+template<> struct search_vec<uint32_t> {
+    using type = uint32<SIMDPP_FAST_INT32_SIZE>;
+    using utype = uint32<SIMDPP_FAST_INT32_SIZE>;
+};
+template<> struct search_vec<int32_t> {
+    using type = int32<SIMDPP_FAST_INT32_SIZE>;
+    using utype = uint32<SIMDPP_FAST_INT32_SIZE>;
+};
+template<> struct search_vec<float> {
+    using type = float32<SIMDPP_FAST_FLOAT32_SIZE>;
+    using utype = uint32<SIMDPP_FAST_FLOAT32_SIZE>;
+};
+
+/*  Loads base[idx0], ..., base[idxN] where base points to 32-bit elements.
+    Indices are interpreted as signed integers by the hardware gather
+    instructions, thus they must be less than 2^31.
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> i_gather_u32(const void* base, const uint32<N>& idx)
+{
+    mem_block<uint32<N>> mi(idx), mr;
+    for (unsigned i = 0; i < N; ++i) {
+        std::memcpy(&mr[i], reinterpret_cast<const char*>(base) + 4 * std::size_t(mi[i]), 4);
+    }
+    return mr;
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_gather_u32(const void* base, const uint32<8>& idx)
+{
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx.native(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_gather_u32(const void* base, const uint32<16>& idx)
+{
+    return _mm512_i32gather_epi32(idx.native(), base, 4);
+}
+#endif
+
+template<class T> SIMDPP_INL
+typename search_vec<T>::type gather_el(const T* base,
+                                       const typename search_vec<T>::utype& idx)
+{
+    return bit_cast<typename search_vec<T>::type>(i_gather_u32(base, idx));
+}
+
+// Returns all ones in elements where a < b, zero otherwise
+template<class V> SIMDPP_INL
+uint32<V::length> lt_bits(const V& a, const V& b)
+{
+    return uint32<V::length>(bit_cast<mask_int32<V::length>>(cmp_lt(a, b)));
+}
+
+// The value that sorts after all other values
+template<class T> SIMDPP_INL
+T search_pad_value()
+{
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                 : std::numeric_limits<T>::max();
+}
+
+template<class T> SIMDPP_INL
+uint32_t lower_bound_scalar(const T* sorted, std::size_t n, T x)
+{
+    if (n == 0) {
+        return 0;
+    }
+    const T* base = sorted;
+    while (n > 1) {
+        std::size_t half = n / 2;
+        base = (base[half] < x) ? base + half : base;
+        n -= half;
+    }
+    return uint32_t(base - sorted) + (*base < x ? 1 : 0);
+}
+
+/*  Searches for a vector of queries at once. All queries take the same number
+    of steps, thus the loop has no data-dependent branches and the loads of
+    different lanes overlap.
+*/
+template<class T> SIMDPP_INL
+typename search_vec<T>::utype lower_bound_vec(const T* sorted, std::size_t n,
+                                              const typename search_vec<T>::type& q)
+{
+    using U = typename search_vec<T>::utype;
+    U base = make_zero();
+    while (n > 1) {
+        std::size_t half = n / 2;
+        U idx = add(base, U(make_uint(half)));
+        U lt = lt_bits(gather_el(sorted, idx), q);
+        base = blend(idx, base, lt);
+        n -= half;
+    }
+    U lt = lt_bits(gather_el(sorted, base), q);
+    return sub(base, lt);
+}
+
+template<class T> SIMDPP_INL
+void lower_bound_batch_impl(const T* sorted, std::size_t n,
+                            const T* queries, std::size_t nq, uint32_t* out)
+{
+    using V = typename search_vec<T>::type;
+    std::size_t i = 0;
+    if (n != 0) {
+        for (; i + 2*V::length <= nq; i += 2*V::length) {
+            // two independent searches to overlap more cache misses
+            V q0 = load_u(queries + i);
+            V q1 = load_u(queries + i + V::length);
+            store_u(out + i, lower_bound_vec(sorted, n, q0));
+            store_u(out + i + V::length, lower_bound_vec(sorted, n, q1));
+        }
+        for (; i + V::length <= nq; i += V::length) {
+            V q = load_u(queries + i);
+            store_u(out + i, lower_bound_vec(sorted, n, q));
+        }
+    }
+    for (; i < nq; ++i) {
+        out[i] = lower_bound_scalar(sorted, n, queries[i]);
+    }
+}
+
+} // namespace detail
+
+/** Finds the position of the first element not less than each of the @a nq
+    queries in the sorted array @a sorted of @a n elements. The results are
+    stored to @a out. The pointers don't need to be aligned. @a n must be less
+    than 2^31.
+
+    @code
+    out[i] = std::lower_bound(sorted, sorted + n, queries[i]) - sorted
+    @endcode
+
+    The queries are processed in vectors: each step of the binary search
+    compares all queries in a vector with the elements loaded with a gather
+    and updates the positions with a blend. This hides the latency of cache
+    misses that dominates the scalar binary search over large arrays.
+*/
+static inline void lower_bound_batch(const uint32_t* sorted, std::size_t n,
+                                     const uint32_t* queries, std::size_t nq,
+                                     uint32_t* out)
+{
+    detail::lower_bound_batch_impl(sorted, n, queries, nq, out);
+}
+
+static inline void lower_bound_batch(const int32_t* sorted, std::size_t n,
+                                     const int32_t* queries, std::size_t nq,
+                                     uint32_t* out)
+{
+    detail::lower_bound_batch_impl(sorted, n, queries, nq, out);
+}
+
+static inline void lower_bound_batch(const float* sorted, std::size_t n,
+                                     const float* queries, std::size_t nq,
+                                     uint32_t* out)
+{
+    detail::lower_bound_batch_impl(sorted, n, queries, nq, out);
+}
+
+/** A search index that stores a sorted array in Eytzinger (BFS) order. The
+    element at position @c k has children at positions @c 2k and @c 2k+1, thus
+    the first levels of the implicit tree share a few cache lines and the
+    memory accesses of a search are much more predictable than those of a
+    binary search over a sorted array.
+
+    The tree is padded to a complete tree with values that sort after all
+    others, so that all searches take the same number of steps.
+
+    @a T must be @c uint32_t, @c int32_t or @c float. The number of elements
+    must be less than 2^30.
+*/
+template<class T>
+class eytzinger_index {
+public:
+    /// Builds the index from @a n elements at @a sorted, which must be sorted
+    /// in ascending order.
+    eytzinger_index(const T* sorted, std::size_t n) :
+        size_(n),
+        depth_(0)
+    {
+        std::size_t tree_size = 1;
+        while (tree_size - 1 < n) {
+            tree_size *= 2;
+            depth_++;
+        }
+        // Position 0 is unused in the tree. It maps to the end of the array
+        // in the rank table.
+        tree_.assign(tree_size, detail::search_pad_value<T>());
+        rank_.assign(tree_size, uint32_t(n));
+
+        std::size_t i = 0;
+        build(sorted, n, i, 1);
+    }
+
+    /// Returns the number of elements in the index
+    std::size_t size() const { return size_; }
+
+    /// Returns the elements in Eytzinger order. The first element is unused.
+    const T* data() const { return tree_.data(); }
+
+    /// Returns the position of the first element not less than @a x in the
+    /// original sorted array.
+    uint32_t lower_bound(T x) const
+    {
+        std::size_t k = 1;
+        std::size_t cand = 0;
+        for (unsigned d = 0; d < depth_; ++d) {
+            bool lt = tree_[k] < x;
+            cand = lt ? cand : k;
+            k = 2 * k + (lt ? 1 : 0);
+        }
+        return rank_[cand];
+    }
+
+    /** Finds the position of the first element not less than each of the
+        @a nq queries in the original sorted array. The results are stored to
+        @a out.
+
+        @code
+        out[i] = lower_bound(queries[i])
+        @endcode
+    */
+    void lower_bound_batch(const T* queries, std::size_t nq, uint32_t* out) const
+    {
+        std::size_t i = 0;
+        for (; i + V::length <= nq; i += V::length) {
+            V q = load_u(queries + i);
+            store_u(out + i, lower_bound_vec(q));
+        }
+        for (; i < nq; ++i) {
+            out[i] = lower_bound(queries[i]);
+        }
+    }
+
+private:
+    using V = typename detail::search_vec<T>::type;
+    using U = typename detail::search_vec<T>::utype;
+
+    U lower_bound_vec(const V& q) const
+    {
+        U k = make_uint(1);
+        U cand = make_zero();
+        U one = make_uint(1);
+        for (unsigned d = 0; d < depth_; ++d) {
+            U lt = detail::lt_bits(detail::gather_el(tree_.data(), k), q);
+            cand = blend(cand, k, lt);
+            k = add(add(k, k), bit_and(lt, one));
+        }
+        return detail::i_gather_u32(rank_.data(), cand);
+    }
+
+    void build(const T* sorted, std::size_t n, std::size_t& i, std::size_t k)
+    {
+        // in-order traversal of the implicit tree visits the elements in
+        // sorted order
+        if (k >= tree_.size()) {
+            return;
+        }
+        build(sorted, n, i, 2 * k);
+        if (i < n) {
+            tree_[k] = sorted[i];
+            rank_[k] = uint32_t(i);
+            i++;
+        }
+        build(sorted, n, i, 2 * k + 1);
+    }
+
+    std::size_t size_;
+    unsigned depth_;
+    std::vector<T> tree_;
+    std::vector<uint32_t> rank_;
+};
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_BINARY_SEARCH_H
@@ -0,0 +1,167 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_BLOCKED_BLOOM_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_BLOCKED_BLOOM_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/hash.h>
+#include <simdpp/core/aligned_allocator.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** A register-blocked Bloom filter. Each key sets 8 bits within a single
+    256-bit block, one bit in each 32-bit word, so that a lookup touches only
+    one cache line and can be done with a single vector load, a few vector
+    operations and @c test_bits_any.
+
+    The block is selected by the upper 32 bits of the 64-bit hash of the key
+    and the bit positions within the words are computed from the lower 32
+    bits by multiplying them by 8 odd constants and taking the upper 5 bits
+    of each product. Keys are hashed with @c hash64_scalar with zero seed.
+    The layout, hash and constants are those of the split block Bloom filter
+    of the Apache Parquet format, thus the filter data is compatible with it.
+
+    The batch functions hash the keys in vectors and prefetch all blocks of a
+    batch before probing them so that the cache misses overlap.
+*/
+class blocked_bloom {
+public:
+    /// The size of a single block in bytes
+    static const std::size_t block_bytes = 32;
+
+    /** Creates an empty filter of @a num_bytes bytes. The size is rounded up
+        to a multiple of the block size. At least one block is allocated.
+    */
+    explicit blocked_bloom(std::size_t num_bytes)
+    {
+        std::size_t num_blocks = (num_bytes + block_bytes - 1) / block_bytes;
+        num_blocks_ = std::max<std::size_t>(num_blocks, 1);
+        data_.assign(num_blocks_ * block_words, 0);
+    }
+
+    /// Returns the number of blocks in the filter
+    std::size_t num_blocks() const { return num_blocks_; }
+
+    /// Returns the size of the filter data in bytes
+    std::size_t size_bytes() const { return num_blocks_ * block_bytes; }
+
+    /// Returns a pointer to the filter data
+    const uint32_t* data() const { return data_.data(); }
+
+    /// Removes all keys from the filter
+    void clear() { std::fill(data_.begin(), data_.end(), 0); }
+
+    /// Inserts a key whose 64-bit hash is @a hash
+    void insert_hash(uint64_t hash)
+    {
+        uint32_t* block = block_ptr(hash);
+        uint32<8> b = load(block);
+        store(block, bit_or(b, bit_mask(uint32_t(hash))));
+    }
+
+    /// Returns @c false if a key whose 64-bit hash is @a hash is definitely
+    /// not in the filter, @c true otherwise.
+    bool contains_hash(uint64_t hash) const
+    {
+        uint32<8> b = load(block_ptr(hash));
+        return !test_bits_any(bit_andnot(bit_mask(uint32_t(hash)), b));
+    }
+
+    /// Inserts @a key to the filter
+    void insert(uint64_t key)
+    {
+        insert_hash(hash64_scalar(key));
+    }
+
+    /// Returns @c false if @a key is definitely not in the filter, @c true
+    /// otherwise.
+    bool contains(uint64_t key) const
+    {
+        return contains_hash(hash64_scalar(key));
+    }
+
+    /// Inserts @a n keys stored at @a keys to the filter
+    void insert_batch(const uint64_t* keys, std::size_t n)
+    {
+        uint64_t hashes[batch_size];
+        for (std::size_t i = 0; i < n; i += batch_size) {
+            std::size_t count = n - i < batch_size ? n - i : batch_size;
+            hash64_batch(keys + i, hashes, count);
+            for (std::size_t j = 0; j < count; ++j) {
+                prefetch_write(block_ptr(hashes[j]));
+            }
+            for (std::size_t j = 0; j < count; ++j) {
+                insert_hash(hashes[j]);
+            }
+        }
+    }
+
+    /** Checks whether each of the @a n keys stored at @a keys may be in the
+        filter. The results are stored to @a out.
+
+        @code
+        out[i] = contains(keys[i])
+        @endcode
+    */
+    void contains_batch(const uint64_t* keys, std::size_t n, bool* out) const
+    {
+        uint64_t hashes[batch_size];
+        for (std::size_t i = 0; i < n; i += batch_size) {
+            std::size_t count = n - i < batch_size ? n - i : batch_size;
+            hash64_batch(keys + i, hashes, count);
+            for (std::size_t j = 0; j < count; ++j) {
+                prefetch_read(block_ptr(hashes[j]));
+            }
+            for (std::size_t j = 0; j < count; ++j) {
+                out[i + j] = contains_hash(hashes[j]);
+            }
+        }
+    }
+
+private:
+    static const std::size_t block_words = block_bytes / sizeof(uint32_t);
+
+    // The number of keys whose blocks are prefetched at once
+    static const std::size_t batch_size = 64;
+
+    static uint32<8> bit_mask(uint32_t key)
+    {
+        uint32<8> salt = make_uint(0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+                                   0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31);
+        uint32<8> pos = shift_r<27>(mul_lo(uint32<8>(splat(key)), salt));
+        return shift_l(uint32<8>(make_uint(1)), pos);
+    }
+
+    std::size_t block_index(uint64_t hash) const
+    {
+        return std::size_t(((hash >> 32) * num_blocks_) >> 32);
+    }
+
+    uint32_t* block_ptr(uint64_t hash)
+    {
+        return data_.data() + block_index(hash) * block_words;
+    }
+
+    const uint32_t* block_ptr(uint64_t hash) const
+    {
+        return data_.data() + block_index(hash) * block_words;
+    }
+
+    std::size_t num_blocks_;
+    std::vector<uint32_t, aligned_allocator<uint32_t, block_bytes>> data_;
+};
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_BLOCKED_BLOOM_H
@@ -0,0 +1,188 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_CRC32_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_CRC32_H
+
+#include <simdpp/simd.h>
+#include <cstddef>
+#include <cstdint>
+
+// The folding code assumes that the bytes of a 64-bit lane are stored in
+// little-endian order.
+#if SIMDPP_USE_PCLMULQDQ || (SIMDPP_DETAIL_USE_NEON_PMULL && !defined(__AARCH64EB__))
+#define SIMDPP_DETAIL_CRC32_USE_CLMUL 1
+#else
+#define SIMDPP_DETAIL_CRC32_USE_CLMUL 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+static const uint32_t crc32_rpoly = 0xEDB88320u;
+static const uint32_t crc32c_rpoly = 0x82F63B78u;
+
+/*  Constants for folding a 128-bit block forward by 1024, 512, 384, 256 and 128
+    bits respectively. Each pair contains x^(d+32) and x^(d-32) modulo the
+    polynomial, bit-reflected and shifted left by one, as the multipliers of
+    the lower and upper 64 bits of the block.
+*/
+static const uint64_t crc32_fold_consts[10] = {
+    0x1e88ef372ull, 0x14a7fe880ull,
+    0x154442bd4ull, 0x1c6e41596ull,
+    0x03db1ecdcull, 0x174359406ull,
+    0x0f1da05aaull, 0x15a546366ull,
+    0x1751997d0ull, 0x0ccaa009eull,
+};
+
+static const uint64_t crc32c_fold_consts[10] = {
+    0x06992cea2ull, 0x00d3b6092ull,
+    0x0740eef02ull, 0x09e4addf8ull,
+    0x01c291d04ull, 0x1d82c63daull,
+    0x1384aa63aull, 0x0ba4fc28eull,
+    0x0f20c0dfeull, 0x14cd00bd6ull,
+};
+
+template<uint32_t RPoly>
+struct crc32_table {
+    uint32_t t[256];
+
+    crc32_table()
+    {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t r = i;
+            for (unsigned j = 0; j < 8; ++j) {
+                r = (r >> 1) ^ ((r & 1) ? RPoly : 0);
+            }
+            t[i] = r;
+        }
+    }
+};
+
+// Updates the CRC register without the initial and final inversion
+template<uint32_t RPoly> SIMDPP_INL
+uint32_t crc32_update_scalar(uint32_t reg, const uint8_t* p, std::size_t len)
+{
+    static const crc32_table<RPoly> table;
+    for (std::size_t i = 0; i < len; ++i) {
+        reg = table.t[(reg ^ p[i]) & 0xff] ^ (reg >> 8);
+    }
+    return reg;
+}
+
+#if SIMDPP_DETAIL_CRC32_USE_CLMUL
+template<unsigned N> SIMDPP_INL
+uint64<N> crc32_fold(const uint64<N>& x, const uint64<N>& k)
+{
+    return bit_xor(clmul_lo(x, k), clmul_hi(x, k));
+}
+#endif
+
+/*  Computes the CRC by folding 128-bit blocks of the input with carry-less
+    multiplication. The blocks are folded into two 512-bit accumulators while
+    at least 128 bytes remain and into a single 128-bit accumulator
+    afterwards. The remaining 128 bits are reduced to the final value using
+    the table-driven code along with the trailing bytes that don't fill a
+    whole block.
+*/
+template<uint32_t RPoly> SIMDPP_INL
+uint32_t crc32_impl(const void* buf, std::size_t len, uint32_t crc,
+                    const uint64_t* k)
+{
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(buf);
+    uint32_t reg = ~crc;
+#if SIMDPP_DETAIL_CRC32_USE_CLMUL
+    if (len >= 16) {
+        uint64<2> x;
+        std::size_t i;
+        if (len >= 128) {
+            uint64<8> x0 = load_u(p);
+            uint64<8> x1 = load_u(p + 64);
+            x0 = bit_xor(x0, uint64<8>(make_uint(reg, 0, 0, 0, 0, 0, 0, 0)));
+
+            uint64<8> k1024 = make_uint(k[0], k[1]);
+            for (i = 128; i + 128 <= len; i += 128) {
+                uint64<8> d0 = load_u(p + i);
+                uint64<8> d1 = load_u(p + i + 64);
+                x0 = bit_xor(crc32_fold(x0, k1024), d0);
+                x1 = bit_xor(crc32_fold(x1, k1024), d1);
+            }
+            x1 = bit_xor(x1, crc32_fold(x0, uint64<8>(make_uint(k[2], k[3]))));
+
+            // fold the first three 128-bit lanes into the last one
+            uint64<8> kl = make_uint(k[4], k[5], k[6], k[7], k[8], k[9], 0, 0);
+            uint64<8> t = crc32_fold(x1, kl);
+            uint64<4> t0, t1, x1lo, x1hi;
+            uint64<2> u0, u1, l2, l3;
+            split(t, t0, t1);
+            split(bit_xor(t0, t1), u0, u1);
+            split(x1, x1lo, x1hi);
+            split(x1hi, l2, l3);
+            x = bit_xor(bit_xor(u0, u1), l3);
+        } else {
+            x = load_u(p);
+            x = bit_xor(x, uint64<2>(make_uint(reg, 0)));
+            i = 16;
+        }
+
+        uint64<2> k128 = make_uint(k[8], k[9]);
+        for (; i + 16 <= len; i += 16) {
+            uint64<2> d = load_u(p + i);
+            x = bit_xor(crc32_fold(x, k128), d);
+        }
+
+        uint8_t rem[16];
+        store_u(rem, x);
+        reg = crc32_update_scalar<RPoly>(0, rem, 16);
+        p += i;
+        len -= i;
+    }
+#else
+    (void) k;
+#endif
+    reg = crc32_update_scalar<RPoly>(reg, p, len);
+    return ~reg;
+}
+
+} // namespace detail
+
+/** Computes the CRC-32C (Castagnoli) checksum of @a len bytes at @a buf. The
+    checksum of data split into several chunks can be computed by passing the
+    result of the previous call as @a crc. The pointer doesn't need to be
+    aligned.
+
+    The input is folded using carry-less multiplication when PCLMULQDQ or
+    AArch64 PMULL is available. Other instruction sets use a table-driven
+    implementation.
+*/
+static inline uint32_t crc32c(const void* buf, std::size_t len, uint32_t crc = 0)
+{
+    return detail::crc32_impl<detail::crc32c_rpoly>(buf, len, crc,
+                                                    detail::crc32c_fold_consts);
+}
+
+/** Computes the CRC-32 checksum of @a len bytes at @a buf as used by zlib,
+    gzip and PNG. The checksum of data split into several chunks can be
+    computed by passing the result of the previous call as @a crc. The pointer
+    doesn't need to be aligned.
+
+    The input is folded using carry-less multiplication when PCLMULQDQ or
+    AArch64 PMULL is available. Other instruction sets use a table-driven
+    implementation.
+*/
+static inline uint32_t crc32(const void* buf, std::size_t len, uint32_t crc = 0)
+{
+    return detail::crc32_impl<detail::crc32_rpoly>(buf, len, crc,
+                                                   detail::crc32_fold_consts);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_CRC32_H
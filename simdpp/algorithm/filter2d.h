@@ -0,0 +1,427 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_FILTER2D_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_FILTER2D_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/transform.h>
+#include <simdpp/core/aligned_allocator.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+template<class T>
+using filter_buffer = std::vector<T, aligned_allocator<T, 64>>;
+
+// The size of the buffers of the intermediate rows of a tile in bytes. The
+// rows and the padded source row of a tile fit into L1 together.
+static const std::size_t filter_tile_bytes = 16384;
+
+/*  Returns the width of the column tiles. The image is processed in tiles of
+    full height so that the @a nky intermediate rows of H of a tile stay in
+    L1 while they are used.
+*/
+template<class H> SIMDPP_INL
+std::size_t filter_tile_width(std::size_t nky)
+{
+    assert(nky != 0);
+    std::size_t w = filter_tile_bytes / (nky * sizeof(H));
+    w = w / 64 * 64;
+    return std::max<std::size_t>(w, 64);
+}
+
+/*  Copies the elements [x0 - rx, x0 + seg + rx) of the row @a src of
+    @a width elements to @a dst, replicating the first and the last elements
+    of the row for the positions outside of it.
+*/
+template<class T, class H> SIMDPP_INL
+void filter_pad_row(const T* src, std::size_t width, std::ptrdiff_t x0,
+                    std::size_t seg, std::size_t rx, H* dst)
+{
+    std::ptrdiff_t begin = x0 - std::ptrdiff_t(rx);
+    std::ptrdiff_t end = x0 + std::ptrdiff_t(seg + rx);
+    std::ptrdiff_t w = std::ptrdiff_t(width);
+    for (std::ptrdiff_t x = begin; x < end; ++x) {
+        std::ptrdiff_t sx = x < 0 ? 0 : (x >= w ? w - 1 : x);
+        *dst++ = H(src[sx]);
+    }
+}
+
+/*  The common driver of the separable filters. For each column tile, the
+    horizontal filter @a fh is applied to each source row once and the result
+    is kept in a ring of @a nky rows. The vertical filter @a fv then combines
+    the rows of the ring into an output row. The rows above and below the
+    image replicate the first and the last rows.
+
+    fh(src_row, x0, seg, H* out) computes seg elements of the intermediate
+    row starting at column x0. fv(y, x0, seg, const H* const* rows)
+    computes the output row y from the intermediate rows y-ry .. y+ry.
+*/
+template<class H, class FH, class FV> SIMDPP_INL
+void filter_rows(std::size_t width, std::size_t height, std::size_t nky,
+                 std::size_t tile, FH fh, FV fv)
+{
+    std::ptrdiff_t ry = std::ptrdiff_t(nky / 2);
+    std::ptrdiff_t h = std::ptrdiff_t(height);
+    filter_buffer<H> ring(nky * tile);
+    std::vector<const H*> rows(nky);
+
+    auto clamp_row = [h](std::ptrdiff_t r) { return std::size_t(r < 0 ? 0 : (r >= h ? h - 1 : r)); };
+    auto slot = [&](std::ptrdiff_t i) { return ring.data() + std::size_t(i) % nky * tile; };
+
+    for (std::size_t x0 = 0; x0 < width; x0 += tile) {
+        std::size_t seg = std::min(tile, width - x0);
+        // the intermediate row r is stored to the slot (r + ry) % nky
+        for (std::ptrdiff_t r = -ry; r < ry; ++r) {
+            fh(clamp_row(r), x0, seg, slot(r + ry));
+        }
+        for (std::ptrdiff_t y = 0; y < h; ++y) {
+            fh(clamp_row(y + ry), x0, seg, slot(y + 2 * ry));
+            for (std::size_t j = 0; j < nky; ++j) {
+                rows[j] = slot(y + std::ptrdiff_t(j));
+            }
+            fv(std::size_t(y), x0, seg, rows.data());
+        }
+    }
+}
+
+template<class T, class D> SIMDPP_INL
+void filter_f32_impl(const T* src, std::size_t src_stride,
+                     D* dst, std::size_t dst_stride,
+                     std::size_t width, std::size_t height,
+                     const float* kx, std::size_t nkx,
+                     const float* ky, std::size_t nky)
+{
+    // the kernels are centered, thus even and empty kernels are invalid
+    assert(nkx % 2 == 1 && nky % 2 == 1);
+    const unsigned L = SIMDPP_FAST_FLOAT32_SIZE;
+    using V = float32<L>;
+    std::size_t tile = filter_tile_width<float>(nky);
+    filter_buffer<float> pad(tile + nkx - 1 + L);
+
+    auto fh = [&](std::size_t sy, std::size_t x0, std::size_t seg, float* out) {
+        filter_pad_row(src + sy * src_stride, width, x0, seg, nkx / 2, pad.data());
+        for (std::size_t x = 0; x < seg; x += L) {
+            V acc = make_zero();
+            for (std::size_t k = 0; k < nkx; ++k) {
+                acc = array_fmadd(V(splat(kx[k])), V(load_u(pad.data() + x + k)), acc);
+            }
+            store(out + x, acc);
+        }
+    };
+    auto fv = [&](std::size_t y, std::size_t x0, std::size_t seg, const float* const* rows) {
+        D* out = dst + y * dst_stride + x0;
+        for (std::size_t x = 0; x < seg; x += L) {
+            V acc = make_zero();
+            for (std::size_t j = 0; j < nky; ++j) {
+                acc = array_fmadd(V(splat(ky[j])), V(load(rows[j] + x)), acc);
+            }
+            if (x + L <= seg) {
+                store_u(out + x, acc);
+            } else {
+                array_store_partial(out + x, acc, seg - x);
+            }
+        }
+    };
+    filter_rows<float>(width, height, nky, tile, fh, fv);
+}
+
+// Narrows 32-bit results to the output type with saturation
+template<unsigned N> SIMDPP_INL
+uint8<N> filter_narrow(const int32<N>& a, uint8_t*)
+{
+    int32<N> r = max(min(a, int32<N>(splat(255))), int32<N>(make_zero()));
+    return to_uint8(to_int16(r));
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> filter_narrow(const int32<N>& a, int16_t*)
+{
+    int32<N> r = max(min(a, int32<N>(splat(32767))), int32<N>(splat(-32768)));
+    return to_int16(r);
+}
+
+/*  The filter of 8-bit images. The horizontal filter is computed in 16-bit
+    integers, which must not overflow. The vertical filter multiplies the
+    16-bit intermediate values by the 16-bit coefficients into 32-bit
+    accumulators, rounds and shifts the sums and narrows them with
+    saturation.
+*/
+template<class D> SIMDPP_INL
+void filter_u8_impl(const uint8_t* src, std::size_t src_stride,
+                    D* dst, std::size_t dst_stride,
+                    std::size_t width, std::size_t height,
+                    const int16_t* kx, std::size_t nkx,
+                    const int16_t* ky, std::size_t nky, unsigned shift)
+{
+    // the kernels are centered, thus even and empty kernels are invalid
+    assert(nkx % 2 == 1 && nky % 2 == 1);
+    const unsigned L = SIMDPP_FAST_INT16_SIZE;
+    using V = int16<L>;
+    // the vertical pass produces whole vectors of 8-bit results
+    const unsigned L2 = L * 2;
+    using V2 = int16<L2>;
+    using VA = int32<L2>;
+    std::size_t tile = filter_tile_width<int16_t>(nky);
+    filter_buffer<int16_t> pad(tile + nkx - 1 + L);
+    int32_t round = shift > 0 ? int32_t(1) << (shift - 1) : 0;
+
+    auto fh = [&](std::size_t sy, std::size_t x0, std::size_t seg, int16_t* out) {
+        filter_pad_row(src + sy * src_stride, width, x0, seg, nkx / 2, pad.data());
+        for (std::size_t x = 0; x < seg; x += L) {
+            V acc = make_zero();
+            for (std::size_t k = 0; k < nkx; ++k) {
+                V p = load_u(pad.data() + x + k);
+                acc = add_sat(acc, mul_lo(p, V(splat(kx[k]))));
+            }
+            store(out + x, acc);
+        }
+    };
+    auto fv = [&](std::size_t y, std::size_t x0, std::size_t seg, const int16_t* const* rows) {
+        D* out = dst + y * dst_stride + x0;
+        for (std::size_t x = 0; x < seg; x += L2) {
+            VA acc = splat(round);
+            for (std::size_t j = 0; j < nky; ++j) {
+                acc = add(acc, mull(V2(load(rows[j] + x)), V2(splat(ky[j]))));
+            }
+            acc = shift_r(acc, shift);
+            auto r = filter_narrow(acc, (D*) nullptr);
+            if (x + L2 <= seg) {
+                store_u(out + x, r);
+            } else {
+                array_store_partial(out + x, r, seg - x);
+            }
+        }
+    };
+    filter_rows<int16_t>(width, height, nky, tile, fh, fv);
+}
+
+// Gaussian kernel of 2*ceil(3*sigma)+1 elements normalized to sum to 1
+static inline std::vector<float> filter_gaussian_kernel(float sigma)
+{
+    std::size_t r = std::size_t(std::ceil(3 * sigma));
+    std::vector<float> k(2 * r + 1);
+    double sum = 0;
+    for (std::size_t i = 0; i < k.size(); ++i) {
+        double d = double(i) - double(r);
+        double v = sigma > 0 ? std::exp(-d * d / (2.0 * sigma * sigma)) : 1.0;
+        k[i] = float(v);
+        sum += v;
+    }
+    for (auto& v : k) {
+        v = float(v / sum);
+    }
+    return k;
+}
+
+/*  Converts a normalized kernel to integers that sum exactly to 2^bits. The
+    rounding error is added to the center coefficient.
+*/
+static inline std::vector<int16_t> filter_fixed_kernel(const std::vector<float>& k,
+                                                       unsigned bits)
+{
+    std::vector<int16_t> r(k.size());
+    int32_t sum = 0;
+    for (std::size_t i = 0; i < k.size(); ++i) {
+        r[i] = int16_t(std::lround(k[i] * float(1 << bits)));
+        sum += r[i];
+    }
+    r[k.size() / 2] = int16_t(r[k.size() / 2] + ((1 << bits) - sum));
+    return r;
+}
+
+} // namespace detail
+
+/** Applies a separable filter to an image of @a width x @a height pixels at
+    @a src and stores the result to @a dst. The rows of the images are
+    @a src_stride and @a dst_stride elements apart. The pixels outside the
+    image are assumed to be equal to the nearest edge pixel.
+
+    @code
+    dst(x,y) = sum(ky[j] * sum(kx[k] * src(x + k - nkx/2, y + j - nky/2)))
+    @endcode
+
+    @a nkx and @a nky must be odd, which is checked by assertions. The image
+    is processed in tiles of full columns narrow enough that the horizontally
+    filtered rows of a tile stay in the L1 cache. Each source row is filtered
+    horizontally once per tile and the vertical filter combines these rows,
+    thus the cost is proportional to @a nkx + @a nky per pixel.
+
+    The 8-bit version takes integer coefficients. The horizontal pass is
+    computed in 16-bit integers and must not overflow: the sum of the
+    absolute values of @a kx must not exceed 128. The vertical pass
+    multiplies the 16-bit intermediate values by @a ky into 32-bit sums
+    using @c mull, adds 2^(shift-1), shifts the sums right by @a shift and
+    narrows them with saturation to the output type.
+*/
+static inline void separable_filter(const float* src, std::size_t src_stride,
+                                    float* dst, std::size_t dst_stride,
+                                    std::size_t width, std::size_t height,
+                                    const float* kx, std::size_t nkx,
+                                    const float* ky, std::size_t nky)
+{
+    // the kernels are centered, thus even and empty kernels are invalid
+    assert(nkx % 2 == 1 && nky % 2 == 1);
+    if (width == 0 || height == 0) {
+        return;
+    }
+    detail::filter_f32_impl(src, src_stride, dst, dst_stride, width, height,
+                            kx, nkx, ky, nky);
+}
+
+static inline void separable_filter(const uint8_t* src, std::size_t src_stride,
+                                    uint8_t* dst, std::size_t dst_stride,
+                                    std::size_t width, std::size_t height,
+                                    const int16_t* kx, std::size_t nkx,
+                                    const int16_t* ky, std::size_t nky,
+                                    unsigned shift)
+{
+    if (width == 0 || height == 0) {
+        return;
+    }
+    detail::filter_u8_impl(src, src_stride, dst, dst_stride, width, height,
+                           kx, nkx, ky, nky, shift);
+}
+
+static inline void separable_filter(const uint8_t* src, std::size_t src_stride,
+                                    int16_t* dst, std::size_t dst_stride,
+                                    std::size_t width, std::size_t height,
+                                    const int16_t* kx, std::size_t nkx,
+                                    const int16_t* ky, std::size_t nky,
+                                    unsigned shift)
+{
+    if (width == 0 || height == 0) {
+        return;
+    }
+    detail::filter_u8_impl(src, src_stride, dst, dst_stride, width, height,
+                           kx, nkx, ky, nky, shift);
+}
+
+/** Computes the mean of the (2*radius+1) x (2*radius+1) neighborhood of each
+    pixel. See @c separable_filter() for the description of the parameters.
+    The 8-bit version divides the sums using a fixed-point reciprocal and may
+    differ from the exactly rounded mean by one. @a radius must not exceed 63
+    for 8-bit images.
+*/
+static inline void box_filter(const float* src, std::size_t src_stride,
+                              float* dst, std::size_t dst_stride,
+                              std::size_t width, std::size_t height,
+                              unsigned radius)
+{
+    std::vector<float> k(2 * radius + 1, 1.0f / float(2 * radius + 1));
+    separable_filter(src, src_stride, dst, dst_stride, width, height,
+                     k.data(), k.size(), k.data(), k.size());
+}
+
+static inline void box_filter(const uint8_t* src, std::size_t src_stride,
+                              uint8_t* dst, std::size_t dst_stride,
+                              std::size_t width, std::size_t height,
+                              unsigned radius)
+{
+    std::size_t n = 2 * radius + 1;
+    std::vector<int16_t> kx(n, 1);
+    // The sums are at most 255 * n^2 and are multiplied by 2^shift / n^2
+    // which must fit into a 16-bit coefficient.
+    unsigned shift = 23;
+    while ((int64_t(1) << shift) / int64_t(n * n) > 32767) {
+        --shift;
+    }
+    int16_t q = int16_t(((int64_t(1) << shift) + int64_t(n * n) / 2) / int64_t(n * n));
+    std::vector<int16_t> ky(n, q);
+    separable_filter(src, src_stride, dst, dst_stride, width, height,
+                     kx.data(), n, ky.data(), n, shift);
+}
+
+/** Applies a Gaussian blur with the standard deviation @a sigma. The kernel
+    is truncated at 3 * @a sigma. See @c separable_filter() for the
+    description of the parameters. The 8-bit version uses coefficients with
+    7 and 12 fractional bits for the horizontal and vertical passes.
+*/
+static inline void gaussian_filter(const float* src, std::size_t src_stride,
+                                   float* dst, std::size_t dst_stride,
+                                   std::size_t width, std::size_t height,
+                                   float sigma)
+{
+    std::vector<float> k = detail::filter_gaussian_kernel(sigma);
+    separable_filter(src, src_stride, dst, dst_stride, width, height,
+                     k.data(), k.size(), k.data(), k.size());
+}
+
+static inline void gaussian_filter(const uint8_t* src, std::size_t src_stride,
+                                   uint8_t* dst, std::size_t dst_stride,
+                                   std::size_t width, std::size_t height,
+                                   float sigma)
+{
+    std::vector<float> k = detail::filter_gaussian_kernel(sigma);
+    std::vector<int16_t> kx = detail::filter_fixed_kernel(k, 7);
+    std::vector<int16_t> ky = detail::filter_fixed_kernel(k, 12);
+    separable_filter(src, src_stride, dst, dst_stride, width, height,
+                     kx.data(), kx.size(), ky.data(), ky.size(), 19);
+}
+
+/** Computes the horizontal and vertical derivatives of an image using the
+    3x3 Sobel operator. @c sobel_x computes the derivative along x:
+
+    @code
+    [ -1 0 1 ]
+    [ -2 0 2 ]
+    [ -1 0 1 ]
+    @endcode
+
+    and @c sobel_y the transposed operator. The derivatives of 8-bit images
+    are stored as 16-bit integers. See @c separable_filter() for the
+    description of the parameters.
+*/
+static inline void sobel_x(const float* src, std::size_t src_stride,
+                           float* dst, std::size_t dst_stride,
+                           std::size_t width, std::size_t height)
+{
+    const float kd[3] = { -1, 0, 1 };
+    const float ks[3] = { 1, 2, 1 };
+    separable_filter(src, src_stride, dst, dst_stride, width, height, kd, 3, ks, 3);
+}
+
+static inline void sobel_x(const uint8_t* src, std::size_t src_stride,
+                           int16_t* dst, std::size_t dst_stride,
+                           std::size_t width, std::size_t height)
+{
+    const int16_t kd[3] = { -1, 0, 1 };
+    const int16_t ks[3] = { 1, 2, 1 };
+    separable_filter(src, src_stride, dst, dst_stride, width, height, kd, 3, ks, 3, 0);
+}
+
+static inline void sobel_y(const float* src, std::size_t src_stride,
+                           float* dst, std::size_t dst_stride,
+                           std::size_t width, std::size_t height)
+{
+    const float kd[3] = { -1, 0, 1 };
+    const float ks[3] = { 1, 2, 1 };
+    separable_filter(src, src_stride, dst, dst_stride, width, height, ks, 3, kd, 3);
+}
+
+static inline void sobel_y(const uint8_t* src, std::size_t src_stride,
+                           int16_t* dst, std::size_t dst_stride,
+                           std::size_t width, std::size_t height)
+{
+    const int16_t kd[3] = { -1, 0, 1 };
+    const int16_t ks[3] = { 1, 2, 1 };
+    separable_filter(src, src_stride, dst, dst_stride, width, height, ks, 3, kd, 3, 0);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_FILTER2D_H
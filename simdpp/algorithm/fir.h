@@ -0,0 +1,220 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_FIR_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_FIR_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/transform.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  Describes the element types of a FIR filter. T is the type of the input
+    and of the taps, R is the type of the output and of the accumulators.
+    mac() computes acc + t * x.
+*/
+struct fir_op_f32 {
+    using T = float;
+    using R = float;
+    static const unsigned L = SIMDPP_FAST_FLOAT32_SIZE;
+    using VT = float32<L>;
+    using VR = float32<L>;
+
+    static SIMDPP_INL VR mac(const VR& acc, const VT& t, const VT& x)
+    {
+        return array_fmadd(t, x, acc);
+    }
+    static SIMDPP_INL R mac_scalar(R acc, T t, T x) { return acc + t * x; }
+};
+
+struct fir_op_i16 {
+    using T = int16_t;
+    using R = int32_t;
+    static const unsigned L = SIMDPP_FAST_INT16_SIZE;
+    using VT = int16<L>;
+    using VR = int32<L>;
+
+    static SIMDPP_INL VR mac(const VR& acc, const VT& t, const VT& x)
+    {
+        return add(acc, mull(t, x));
+    }
+    static SIMDPP_INL R mac_scalar(R acc, T t, T x)
+    {
+        return R(uint32_t(acc) + uint32_t(int32_t(t) * x));
+    }
+};
+
+struct fir_op_i32 {
+    using T = int32_t;
+    using R = int32_t;
+    static const unsigned L = SIMDPP_FAST_INT32_SIZE;
+    using VT = int32<L>;
+    using VR = int32<L>;
+
+    static SIMDPP_INL VR mac(const VR& acc, const VT& t, const VT& x)
+    {
+        return add(acc, mul_lo(t, x));
+    }
+    static SIMDPP_INL R mac_scalar(R acc, T t, T x)
+    {
+        return R(uint32_t(acc) + uint32_t(t) * uint32_t(x));
+    }
+};
+
+// Computes the outputs [i, n) one by one
+template<class Op> SIMDPP_INL
+void fir_scalar(const typename Op::T* in, std::size_t i, std::size_t n,
+                const typename Op::T* taps, std::size_t ntaps,
+                typename Op::R* out)
+{
+    using R = typename Op::R;
+    for (; i < n; ++i) {
+        R acc = 0;
+        for (std::size_t j = 0; j < ntaps; ++j) {
+            acc = Op::mac_scalar(acc, taps[ntaps - 1 - j], in[i + j]);
+        }
+        out[i] = acc;
+    }
+}
+
+/*  The filter with a tap count known at compile time. The broadcast taps are
+    kept in registers and the loop over the taps is unrolled. Each tap is
+    applied to two overlapping windows of the input loaded with load_u.
+*/
+template<class Op, unsigned NT> SIMDPP_INL
+void fir_fixed(const typename Op::T* in, std::size_t n,
+               const typename Op::T* taps, typename Op::R* out)
+{
+    using VT = typename Op::VT;
+    using VR = typename Op::VR;
+    const unsigned L = Op::L;
+
+    VT t[NT];
+    array_unroll<NT>([&](unsigned j) { t[j] = splat(taps[NT - 1 - j]); });
+
+    std::size_t i = 0;
+    for (; i + 2*L <= n; i += 2*L) {
+        array_prefetch(in + i);
+        VR acc0 = make_zero(), acc1 = make_zero();
+        array_unroll<NT>([&](unsigned j) {
+            acc0 = Op::mac(acc0, t[j], VT(load_u(in + i + j)));
+            acc1 = Op::mac(acc1, t[j], VT(load_u(in + i + L + j)));
+        });
+        store_u(out + i, acc0);
+        store_u(out + i + L, acc1);
+    }
+    fir_scalar<Op>(in, i, n, taps, NT, out);
+}
+
+template<class Op> SIMDPP_INL
+void fir_generic(const typename Op::T* in, std::size_t n,
+                 const typename Op::T* taps, std::size_t ntaps,
+                 typename Op::R* out)
+{
+    using VT = typename Op::VT;
+    using VR = typename Op::VR;
+    const unsigned L = Op::L;
+
+    // Four output vectors at a time so that each broadcast tap is used four
+    // times and the latency of the accumulation is hidden
+    std::size_t i = 0;
+    for (; i + 4*L <= n; i += 4*L) {
+        array_prefetch(in + i);
+        VR acc0 = make_zero(), acc1 = make_zero(), acc2 = make_zero(), acc3 = make_zero();
+        const typename Op::T* p = in + i;
+        for (std::size_t j = 0; j < ntaps; ++j, ++p) {
+            VT t = load_splat(taps + ntaps - 1 - j);
+            acc0 = Op::mac(acc0, t, VT(load_u(p)));
+            acc1 = Op::mac(acc1, t, VT(load_u(p + L)));
+            acc2 = Op::mac(acc2, t, VT(load_u(p + 2*L)));
+            acc3 = Op::mac(acc3, t, VT(load_u(p + 3*L)));
+        }
+        store_u(out + i, acc0);
+        store_u(out + i + L, acc1);
+        store_u(out + i + 2*L, acc2);
+        store_u(out + i + 3*L, acc3);
+    }
+    for (; i + L <= n; i += L) {
+        VR acc = make_zero();
+        for (std::size_t j = 0; j < ntaps; ++j) {
+            VT t = load_splat(taps + ntaps - 1 - j);
+            acc = Op::mac(acc, t, VT(load_u(in + i + j)));
+        }
+        store_u(out + i, acc);
+    }
+    fir_scalar<Op>(in, i, n, taps, ntaps, out);
+}
+
+template<class Op> SIMDPP_INL
+void fir_impl(const typename Op::T* in, std::size_t n,
+              const typename Op::T* taps, std::size_t ntaps,
+              typename Op::R* out)
+{
+    switch (ntaps) {
+    case 0: fir_scalar<Op>(in, 0, n, taps, 0, out); return;
+    case 1: fir_fixed<Op, 1>(in, n, taps, out); return;
+    case 2: fir_fixed<Op, 2>(in, n, taps, out); return;
+    case 3: fir_fixed<Op, 3>(in, n, taps, out); return;
+    case 4: fir_fixed<Op, 4>(in, n, taps, out); return;
+    case 5: fir_fixed<Op, 5>(in, n, taps, out); return;
+    case 6: fir_fixed<Op, 6>(in, n, taps, out); return;
+    case 7: fir_fixed<Op, 7>(in, n, taps, out); return;
+    case 8: fir_fixed<Op, 8>(in, n, taps, out); return;
+    default: fir_generic<Op>(in, n, taps, ntaps, out); return;
+    }
+}
+
+} // namespace detail
+
+/** Applies a finite impulse response filter with @a ntaps coefficients
+    @a taps to the input signal @a in and stores @a n output samples to
+    @a out.
+
+    @code
+    for (i = 0; i < n; ++i)
+        out[i] = sum(taps[k] * in[i + ntaps - 1 - k] for k = 0 .. ntaps-1)
+    @endcode
+
+    That is, @a in must contain @a n + @a ntaps - 1 samples: the last
+    @a ntaps - 1 samples of the previous block, which form the history of the
+    filter, followed by @a n new samples. The pointers don't need to be
+    aligned. @a out must not overlap @a in.
+
+    The outputs are computed in vectors by multiplying unaligned windows of
+    the input loaded with @c load_u by broadcast taps and accumulating the
+    products with @c fmadd if it's available. Filters of up to 8 taps are
+    specialized at compile time so that the taps are kept in registers.
+
+    The @c int16_t variant accumulates the full 32-bit products in 32-bit
+    integers. The integer sums wrap around on overflow.
+*/
+static inline void fir_filter(const float* in, std::size_t n,
+                              const float* taps, std::size_t ntaps, float* out)
+{
+    detail::fir_impl<detail::fir_op_f32>(in, n, taps, ntaps, out);
+}
+
+static inline void fir_filter(const int16_t* in, std::size_t n,
+                              const int16_t* taps, std::size_t ntaps, int32_t* out)
+{
+    detail::fir_impl<detail::fir_op_i16>(in, n, taps, ntaps, out);
+}
+
+static inline void fir_filter(const int32_t* in, std::size_t n,
+                              const int32_t* taps, std::size_t ntaps, int32_t* out)
+{
+    detail::fir_impl<detail::fir_op_i32>(in, n, taps, ntaps, out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_FIR_H
@@ -0,0 +1,377 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_GEMM_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_GEMM_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/transform.h>
+#include <simdpp/core/aligned_allocator.h>
+#include <simdpp/dispatch/get_cache_info.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  The number of rows of the register block of the micro-kernel. The block
+    consists of MR x 2 native vectors of accumulators, which together with
+    two vectors of B and one broadcast element of A must fit into the
+    register file: 6x2 for 16 registers and 14x2 for 32 registers.
+*/
+#if SIMDPP_USE_NULL
+static const unsigned gemm_mr = 4;
+#elif SIMDPP_USE_AVX512F || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+static const unsigned gemm_mr = 14;
+#else
+static const unsigned gemm_mr = 6;
+#endif
+
+template<class T> struct gemm_nr {
+    static const unsigned value = 2 * array_fast_size<T>::value;
+};
+
+/*  Cache blocking parameters. The packed panel of B of KC x NR elements
+    stays in L1, the packed block of A of MC x KC elements stays in L2 and
+    the packed block of B of KC x NC elements stays in L3. Each takes about
+    half of the respective cache.
+*/
+struct gemm_blocking {
+    std::size_t kc, mc, nc;
+};
+
+template<class T> SIMDPP_INL
+gemm_blocking gemm_get_blocking()
+{
+    const std::size_t MR = gemm_mr;
+    const std::size_t NR = gemm_nr<T>::value;
+
+    // the typical sizes are used for the caches that are not known
+    CacheInfo cache = get_cache_info();
+    std::size_t l1 = cache.l1d_size != 0 ? cache.l1d_size : 32 * 1024;
+    std::size_t l2 = cache.l2_size != 0 ? cache.l2_size : 256 * 1024;
+
+    gemm_blocking r;
+    r.kc = l1 / 2 / (NR * sizeof(T));
+    r.kc = std::min<std::size_t>(std::max<std::size_t>(r.kc, 16), 1024);
+    r.mc = l2 / 2 / (r.kc * sizeof(T)) / MR * MR;
+    r.mc = std::min(std::max(r.mc, MR), MR * 64);
+
+    std::size_t nc_panels = 64;
+    if (cache.l3_size != 0) {
+        nc_panels = cache.l3_size / 2 / (r.kc * NR * sizeof(T));
+        nc_panels = std::min<std::size_t>(std::max<std::size_t>(nc_panels, 16), 256);
+    }
+    r.nc = NR * nc_panels;
+    return r;
+}
+
+template<class T>
+using gemm_buffer = std::vector<T, aligned_allocator<T, 64>>;
+
+/*  Packs the rows [0, mc) and columns [0, kc) of A into panels of MR rows.
+    Within a panel the elements are stored column by column, so that the
+    micro-kernel reads MR consecutive elements for each column. The rows past
+    @a mc are padded with zeros.
+*/
+template<class T> SIMDPP_INL
+void gemm_pack_a(T* dst, const T* a, std::size_t lda,
+                 std::size_t mc, std::size_t kc)
+{
+    const unsigned MR = gemm_mr;
+    for (std::size_t i = 0; i < mc; i += MR) {
+        std::size_t rows = std::min<std::size_t>(MR, mc - i);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t r = 0; r < rows; ++r) {
+                dst[r] = a[(i + r) * lda + p];
+            }
+            for (std::size_t r = rows; r < MR; ++r) {
+                dst[r] = 0;
+            }
+            dst += MR;
+        }
+    }
+}
+
+/*  Packs the rows [0, kc) and columns [0, nc) of B into panels of NR
+    columns. Within a panel the elements are stored row by row. The columns
+    past @a nc are padded with zeros.
+*/
+template<class T> SIMDPP_INL
+void gemm_pack_b(T* dst, const T* b, std::size_t ldb,
+                 std::size_t kc, std::size_t nc)
+{
+    const unsigned NR = gemm_nr<T>::value;
+    for (std::size_t j = 0; j < nc; j += NR) {
+        std::size_t cols = std::min<std::size_t>(NR, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            std::memcpy(dst, b + p * ldb + j, cols * sizeof(T));
+            std::memset(dst + cols, 0, (NR - cols) * sizeof(T));
+            dst += NR;
+        }
+    }
+}
+
+/*  Computes C[0:mr, 0:nr] = alpha * A_panel * B_panel + beta * C[0:mr, 0:nr]
+    where the panels have been packed by gemm_pack_a and gemm_pack_b. The
+    whole MR x NR block is computed in registers. If beta is zero, C is not
+    read.
+*/
+template<class T> SIMDPP_INL
+void gemm_kernel(std::size_t kc, const T* pa, const T* pb,
+                 T* c, std::size_t ldc, std::size_t mr, std::size_t nr,
+                 T alpha, T beta)
+{
+    const unsigned MR = gemm_mr;
+    const unsigned L = array_fast_size<T>::value;
+    const unsigned NR = gemm_nr<T>::value;
+    using V = typename array_vec<T, L>::type;
+
+    V acc0[MR], acc1[MR];
+    auto init = [&](unsigned r) {
+        acc0[r] = make_zero();
+        acc1[r] = make_zero();
+    };
+    array_unroll<MR>(init);
+
+    V b0, b1;
+    auto step = [&](unsigned r) {
+        V av = load_splat(pa + r);
+        acc0[r] = array_fmadd(av, b0, acc0[r]);
+        acc1[r] = array_fmadd(av, b1, acc1[r]);
+    };
+    for (std::size_t p = 0; p < kc; ++p) {
+        b0 = load(pb);
+        b1 = load(pb + L);
+        array_unroll<MR>(step);
+        pa += MR;
+        pb += NR;
+    }
+
+    V valpha = splat(alpha);
+    V vbeta = splat(beta);
+    if (mr == MR && nr == NR) {
+        auto finish = [&](unsigned r) {
+            T* cr = c + r * ldc;
+            V r0 = mul(acc0[r], valpha);
+            V r1 = mul(acc1[r], valpha);
+            if (beta != T(0)) {
+                r0 = array_fmadd(V(load_u(cr)), vbeta, r0);
+                r1 = array_fmadd(V(load_u(cr + L)), vbeta, r1);
+            }
+            store_u(cr, r0);
+            store_u(cr + L, r1);
+        };
+        array_unroll<MR>(finish);
+        return;
+    }
+
+    // edge blocks
+    SIMDPP_ALIGN(sizeof(V)) T buf[NR];
+    auto finish_edge = [&](unsigned r) {
+        if (r >= mr) {
+            return;
+        }
+        T* cr = c + r * ldc;
+        store(buf, mul(acc0[r], valpha));
+        store(buf + L, mul(acc1[r], valpha));
+        for (std::size_t j = 0; j < nr; ++j) {
+            cr[j] = beta != T(0) ? buf[j] + beta * cr[j] : buf[j];
+        }
+    };
+    array_unroll<MR>(finish_edge);
+}
+
+template<class T> SIMDPP_INL
+void gemm_scale(std::size_t m, std::size_t n, T beta, T* c, std::size_t ldc)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        T* cr = c + i * ldc;
+        for (std::size_t j = 0; j < n; ++j) {
+            cr[j] = beta != T(0) ? cr[j] * beta : T(0);
+        }
+    }
+}
+
+template<class T> SIMDPP_INL
+void gemm_impl(std::size_t m, std::size_t n, std::size_t k,
+               T alpha, const T* a, std::size_t lda,
+               const T* b, std::size_t ldb,
+               T beta, T* c, std::size_t ldc)
+{
+    const unsigned MR = gemm_mr;
+    const unsigned NR = gemm_nr<T>::value;
+    const gemm_blocking blocking = gemm_get_blocking<T>();
+    const std::size_t KC = blocking.kc;
+    const std::size_t MC = blocking.mc;
+    const std::size_t NC = blocking.nc;
+
+    if (m == 0 || n == 0) {
+        return;
+    }
+    if (k == 0 || alpha == T(0)) {
+        gemm_scale(m, n, beta, c, ldc);
+        return;
+    }
+
+    std::size_t kc_max = std::min(KC, k);
+    std::size_t mc_max = std::min(MC, (m + MR - 1) / MR * MR);
+    std::size_t nc_max = std::min(NC, (n + NR - 1) / NR * NR);
+    gemm_buffer<T> buf_a(mc_max * kc_max);
+    gemm_buffer<T> buf_b(kc_max * nc_max);
+
+    for (std::size_t jc = 0; jc < n; jc += NC) {
+        std::size_t nc = std::min(NC, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += KC) {
+            std::size_t kc = std::min(KC, k - pc);
+            // beta is applied only once, to the first partial product
+            T beta_pc = pc == 0 ? beta : T(1);
+            gemm_pack_b(buf_b.data(), b + pc * ldb + jc, ldb, kc, nc);
+
+            for (std::size_t ic = 0; ic < m; ic += MC) {
+                std::size_t mc = std::min(MC, m - ic);
+                gemm_pack_a(buf_a.data(), a + ic * lda + pc, lda, mc, kc);
+
+                for (std::size_t jr = 0; jr < nc; jr += NR) {
+                    std::size_t nr = std::min<std::size_t>(NR, nc - jr);
+                    const T* pb = buf_b.data() + jr * kc;
+                    for (std::size_t ir = 0; ir < mc; ir += MR) {
+                        std::size_t mr = std::min<std::size_t>(MR, mc - ir);
+                        const T* pa = buf_a.data() + ir * kc;
+                        gemm_kernel(kc, pa, pb, c + (ic + ir) * ldc + jc + jr,
+                                    ldc, mr, nr, alpha, beta_pc);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<class T> SIMDPP_INL
+void gemv_impl(std::size_t m, std::size_t n, T alpha, const T* a, std::size_t lda,
+               const T* x, T beta, T* y)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+
+    auto finish = [&](std::size_t i, const V& acc) {
+        T r = alpha * reduce_add(acc);
+        y[i] = beta != T(0) ? r + beta * y[i] : r;
+    };
+
+    // Four rows at a time so that each loaded vector of x is used four times
+    std::size_t i = 0;
+    for (; i + 4 <= m; i += 4) {
+        const T* a0 = a + i * lda;
+        const T* a1 = a0 + lda;
+        const T* a2 = a1 + lda;
+        const T* a3 = a2 + lda;
+        V acc0 = make_zero(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        std::size_t j = 0;
+        for (; j + L <= n; j += L) {
+            V xv = load_u(x + j);
+            acc0 = array_fmadd(V(load_u(a0 + j)), xv, acc0);
+            acc1 = array_fmadd(V(load_u(a1 + j)), xv, acc1);
+            acc2 = array_fmadd(V(load_u(a2 + j)), xv, acc2);
+            acc3 = array_fmadd(V(load_u(a3 + j)), xv, acc3);
+        }
+        if (j < n) {
+            V xv = array_load_partial<L>(x + j, n - j);
+            acc0 = array_fmadd(V(array_load_partial<L>(a0 + j, n - j)), xv, acc0);
+            acc1 = array_fmadd(V(array_load_partial<L>(a1 + j, n - j)), xv, acc1);
+            acc2 = array_fmadd(V(array_load_partial<L>(a2 + j, n - j)), xv, acc2);
+            acc3 = array_fmadd(V(array_load_partial<L>(a3 + j, n - j)), xv, acc3);
+        }
+        finish(i, acc0);
+        finish(i + 1, acc1);
+        finish(i + 2, acc2);
+        finish(i + 3, acc3);
+    }
+    for (; i < m; ++i) {
+        const T* a0 = a + i * lda;
+        V acc0 = make_zero();
+        std::size_t j = 0;
+        for (; j + L <= n; j += L) {
+            acc0 = array_fmadd(V(load_u(a0 + j)), V(load_u(x + j)), acc0);
+        }
+        if (j < n) {
+            acc0 = array_fmadd(V(array_load_partial<L>(a0 + j, n - j)),
+                               V(array_load_partial<L>(x + j, n - j)), acc0);
+        }
+        finish(i, acc0);
+    }
+}
+
+} // namespace detail
+
+/** Computes the matrix product @c C = alpha*A*B + beta*C, where @a A is a
+    @a m x @a k matrix, @a B is a @a k x @a n matrix and @a C is a @a m x @a n
+    matrix. All matrices are stored in row-major order: element @c (i,j) of A
+    is at @c a[i*lda+j] and likewise for B and C. The pointers don't need to
+    be aligned. If @a beta is zero, @a C is not read, thus it may contain
+    NaNs.
+
+    The product is computed by a register-blocked micro-kernel that keeps a
+    block of MR x 2 native vectors of C in registers, e.g. 6x16 elements of
+    @c float for AVX2 and 14x32 for AVX-512. For each column of the block of
+    A an element is broadcast with @c load_splat and multiplied by two
+    vectors of B using @c fmadd if it is available. The blocks of A and B are
+    packed into contiguous buffers sized for the L2 and L1 caches
+    respectively. The sizes of the caches are retrieved at runtime using
+    @c get_cache_info(). The buffers are allocated on each call.
+
+    The functions take only pointers and scalars, thus they can be wrapped
+    in a function that is compiled for several architectures and selected
+    at runtime using @c SIMDPP_MAKE_DISPATCHER.
+*/
+static inline void gemm(std::size_t m, std::size_t n, std::size_t k,
+                        float alpha, const float* a, std::size_t lda,
+                        const float* b, std::size_t ldb,
+                        float beta, float* c, std::size_t ldc)
+{
+    detail::gemm_impl(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void gemm(std::size_t m, std::size_t n, std::size_t k,
+                        double alpha, const double* a, std::size_t lda,
+                        const double* b, std::size_t ldb,
+                        double beta, double* c, std::size_t ldc)
+{
+    detail::gemm_impl(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+/** Computes the matrix-vector product @c y = alpha*A*x + beta*y, where @a A
+    is a @a m x @a n matrix stored in row-major order with row stride @a lda,
+    @a x is a vector of @a n elements and @a y is a vector of @a m elements.
+    The pointers don't need to be aligned. If @a beta is zero, @a y is not
+    read.
+
+    Four rows of A are processed at once so that each vector of @a x is
+    loaded once for all of them. The order in which the products are summed
+    depends on the vector width of the target architecture.
+*/
+static inline void gemv(std::size_t m, std::size_t n,
+                        float alpha, const float* a, std::size_t lda,
+                        const float* x, float beta, float* y)
+{
+    detail::gemv_impl(m, n, alpha, a, lda, x, beta, y);
+}
+
+static inline void gemv(std::size_t m, std::size_t n,
+                        double alpha, const double* a, std::size_t lda,
+                        const double* x, double beta, double* y)
+{
+    detail::gemv_impl(m, n, alpha, a, lda, x, beta, y);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_GEMM_H
@@ -0,0 +1,283 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_HASH_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_HASH_H
+
+#include <simdpp/simd.h>
+#include <simdpp/detail/vector_array_macros.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+static const uint32_t xxh32_prime1 = 0x9E3779B1u;
+static const uint32_t xxh32_prime2 = 0x85EBCA77u;
+static const uint32_t xxh32_prime3 = 0xC2B2AE3Du;
+static const uint32_t xxh32_prime4 = 0x27D4EB2Fu;
+static const uint32_t xxh32_prime5 = 0x165667B1u;
+
+static const uint64_t xxh64_prime1 = 0x9E3779B185EBCA87ull;
+static const uint64_t xxh64_prime2 = 0xC2B2AE3D27D4EB4Full;
+static const uint64_t xxh64_prime3 = 0x165667B19E3779F9ull;
+static const uint64_t xxh64_prime4 = 0x85EBCA77C2B2AE63ull;
+static const uint64_t xxh64_prime5 = 0x27D4EB2F165667C5ull;
+
+static SIMDPP_INL uint32_t rotl_scalar(uint32_t x, unsigned r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+static SIMDPP_INL uint64_t rotl_scalar(uint64_t x, unsigned r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+template<unsigned R, unsigned N> SIMDPP_INL
+uint32<N> rotl(const uint32<N>& a)
+{
+    return bit_or(shift_l<R>(a), shift_r<32-R>(a));
+}
+
+template<unsigned R, unsigned N> SIMDPP_INL
+uint64<N> rotl(const uint64<N>& a)
+{
+    return bit_or(shift_l<R>(a), shift_r<64-R>(a));
+}
+
+/*  Computes the lower 64 bits of a * b for each element. There's no native
+    64-bit multiplication before AVX-512DQ, so the product is assembled from
+    32-bit pieces: lo(a)*lo(b) is computed with widening multiplication and the
+    cross terms contribute only to the upper half of the result.
+*/
+static SIMDPP_INL
+uint64<2> i_mul_lo_u64(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm_mullo_epi64(a.native(), b.native());
+#elif SIMDPP_USE_SSE2
+    __m128i lolo = _mm_mul_epu32(a.native(), b.native());
+    __m128i hilo = _mm_mul_epu32(_mm_srli_epi64(a.native(), 32), b.native());
+    __m128i lohi = _mm_mul_epu32(a.native(), _mm_srli_epi64(b.native(), 32));
+    __m128i cross = _mm_slli_epi64(_mm_add_epi64(hilo, lohi), 32);
+    return _mm_add_epi64(lolo, cross);
+#else
+    uint32<4> a32 = uint32<4>(a);
+    uint32<4> b32 = uint32<4>(b);
+
+    // full products of the lower and upper halves; we only need the former
+    uint64<4> prod = mull(a32, b32);
+    uint64<2> lolo = unzip2_lo(prod.vec<0>(), prod.vec<1>());
+
+    // the lower and upper 32 bits of t contain hi(a)*lo(b) and lo(a)*hi(b)
+    uint64<2> t = uint64<2>(mul_lo(permute4<1,0,3,2>(a32), b32));
+    uint64<2> cross = add(shift_l<32>(t),
+                          bit_and(t, uint64<2>(make_uint(0xffffffff00000000ull))));
+    return add(lolo, cross);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_lo_u64(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm256_mullo_epi64(a.native(), b.native());
+#else
+    __m256i lolo = _mm256_mul_epu32(a.native(), b.native());
+    __m256i hilo = _mm256_mul_epu32(_mm256_srli_epi64(a.native(), 32), b.native());
+    __m256i lohi = _mm256_mul_epu32(a.native(), _mm256_srli_epi64(b.native(), 32));
+    __m256i cross = _mm256_slli_epi64(_mm256_add_epi64(hilo, lohi), 32);
+    return _mm256_add_epi64(lolo, cross);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_lo_u64(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_mullo_epi64(a.native(), b.native());
+#else
+    __m512i lolo = _mm512_mul_epu32(a.native(), b.native());
+    __m512i hilo = _mm512_mul_epu32(_mm512_srli_epi64(a.native(), 32), b.native());
+    __m512i lohi = _mm512_mul_epu32(a.native(), _mm512_srli_epi64(b.native(), 32));
+    __m512i cross = _mm512_slli_epi64(_mm512_add_epi64(hilo, lohi), 32);
+    return _mm512_add_epi64(lolo, cross);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_mul_lo_u64(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, uint64<N>, i_mul_lo_u64, a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> mul_lo_u64(const uint64<N>& a, uint64_t c)
+{
+    return i_mul_lo_u64(a, uint64<N>(make_uint(c)));
+}
+
+} // namespace detail
+
+/** Computes a 32-bit hash of a single 32-bit key. This is the scalar reference
+    for @c hash32 and @c hash32_batch. The result is equal to
+    @c XXH32(&key, 4, seed) for the key stored in little-endian byte order.
+*/
+static inline uint32_t hash32_scalar(uint32_t key, uint32_t seed = 0)
+{
+    using namespace detail;
+    uint32_t h = seed + xxh32_prime5 + 4;
+    h += key * xxh32_prime3;
+    h = rotl_scalar(h, 17) * xxh32_prime4;
+
+    h ^= h >> 15;
+    h *= xxh32_prime2;
+    h ^= h >> 13;
+    h *= xxh32_prime3;
+    h ^= h >> 16;
+    return h;
+}
+
+/** Computes a 64-bit hash of a single 64-bit key. This is the scalar reference
+    for @c hash64 and @c hash64_batch. The result is equal to
+    @c XXH64(&key, 8, seed) for the key stored in little-endian byte order.
+*/
+static inline uint64_t hash64_scalar(uint64_t key, uint64_t seed = 0)
+{
+    using namespace detail;
+    uint64_t h = seed + xxh64_prime5 + 8;
+    uint64_t k = rotl_scalar(key * xxh64_prime2, 31) * xxh64_prime1;
+    h ^= k;
+    h = rotl_scalar(h, 27) * xxh64_prime1 + xxh64_prime4;
+
+    h ^= h >> 33;
+    h *= xxh64_prime2;
+    h ^= h >> 29;
+    h *= xxh64_prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+/** Hashes each 32-bit element of the vector independently. Each result
+    element is bit-identical to @c hash32_scalar applied to the corresponding
+    key.
+
+    @code
+    r0 = hash32_scalar(a0, seed)
+    ...
+    rN = hash32_scalar(aN, seed)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> hash32(const uint32<N>& keys, uint32_t seed = 0)
+{
+    using namespace detail;
+    uint32<N> h = make_uint(seed + xxh32_prime5 + 4);
+    h = add(h, mul_lo(keys, uint32<N>(make_uint(xxh32_prime3))));
+    h = mul_lo(rotl<17>(h), uint32<N>(make_uint(xxh32_prime4)));
+
+    h = bit_xor(h, shift_r<15>(h));
+    h = mul_lo(h, uint32<N>(make_uint(xxh32_prime2)));
+    h = bit_xor(h, shift_r<13>(h));
+    h = mul_lo(h, uint32<N>(make_uint(xxh32_prime3)));
+    h = bit_xor(h, shift_r<16>(h));
+    return h;
+}
+
+/** Hashes each 64-bit element of the vector independently. Each result
+    element is bit-identical to @c hash64_scalar applied to the corresponding
+    key.
+
+    @code
+    r0 = hash64_scalar(a0, seed)
+    ...
+    rN = hash64_scalar(aN, seed)
+    @endcode
+
+    64-bit multiplication is emulated using 32-bit widening multiplication
+    except on AVX-512DQ, thus this function is considerably slower than
+    @c hash32 on most instruction sets.
+*/
+template<unsigned N> SIMDPP_INL
+uint64<N> hash64(const uint64<N>& keys, uint64_t seed = 0)
+{
+    using namespace detail;
+    uint64<N> h = make_uint(seed + xxh64_prime5 + 8);
+    uint64<N> k = mul_lo_u64(keys, xxh64_prime2);
+    k = mul_lo_u64(rotl<31>(k), xxh64_prime1);
+    h = bit_xor(h, k);
+    h = add(mul_lo_u64(rotl<27>(h), xxh64_prime1),
+            uint64<N>(make_uint(xxh64_prime4)));
+
+    h = bit_xor(h, shift_r<33>(h));
+    h = mul_lo_u64(h, xxh64_prime2);
+    h = bit_xor(h, shift_r<29>(h));
+    h = mul_lo_u64(h, xxh64_prime3);
+    h = bit_xor(h, shift_r<32>(h));
+    return h;
+}
+
+/** Hashes @a n 32-bit keys stored at @a keys and stores the results to @a out.
+    The pointers don't need to be aligned. The result for each key is
+    bit-identical to @c hash32_scalar.
+*/
+static inline void hash32_batch(const uint32_t* keys, uint32_t* out,
+                                std::size_t n, uint32_t seed = 0)
+{
+    using V = uint32<SIMDPP_FAST_INT32_SIZE>;
+    std::size_t i = 0;
+    for (; i + 2*V::length <= n; i += 2*V::length) {
+        // two independent chains to hide multiplication latency
+        V k0 = load_u(keys + i);
+        V k1 = load_u(keys + i + V::length);
+        store_u(out + i, hash32(k0, seed));
+        store_u(out + i + V::length, hash32(k1, seed));
+    }
+    for (; i + V::length <= n; i += V::length) {
+        V k = load_u(keys + i);
+        store_u(out + i, hash32(k, seed));
+    }
+    for (; i < n; ++i) {
+        out[i] = hash32_scalar(keys[i], seed);
+    }
+}
+
+/** Hashes @a n 64-bit keys stored at @a keys and stores the results to @a out.
+    The pointers don't need to be aligned. The result for each key is
+    bit-identical to @c hash64_scalar.
+*/
+static inline void hash64_batch(const uint64_t* keys, uint64_t* out,
+                                std::size_t n, uint64_t seed = 0)
+{
+    using V = uint64<SIMDPP_FAST_INT64_SIZE>;
+    std::size_t i = 0;
+    for (; i + 2*V::length <= n; i += 2*V::length) {
+        V k0 = load_u(keys + i);
+        V k1 = load_u(keys + i + V::length);
+        store_u(out + i, hash64(k0, seed));
+        store_u(out + i + V::length, hash64(k1, seed));
+    }
+    for (; i + V::length <= n; i += V::length) {
+        V k = load_u(keys + i);
+        store_u(out + i, hash64(k, seed));
+    }
+    for (; i < n; ++i) {
+        out[i] = hash64_scalar(keys[i], seed);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_HASH_H
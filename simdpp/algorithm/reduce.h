@@ -0,0 +1,747 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_REDUCE_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_REDUCE_H
+
+#include <simdpp/simd.h>
+#include <simdpp/detail/fma.h>
+#include <simdpp/algorithm/hash.h>
+#include <simdpp/algorithm/transform.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// Selects how floating-point sums over arrays are computed
+enum class reduce_mode {
+    /** The elements are summed in several independent accumulators. The
+        order of the additions depends on the vector width of the target
+        architecture.
+    */
+    fast,
+
+    /** As @c fast, but the rounding error of each addition is computed
+        exactly and accumulated separately. The result is the same as of
+        @c sum_compensated().
+    */
+    compensated,
+
+    /** The elements are summed in a fixed order that doesn't depend on the
+        target architecture, thus the results are bit-identical on all
+        instruction sets. Element @c i is added to lane @c i%16 of one of two
+        16-lane accumulators, selected by the parity of @c i/16. The
+        accumulators are added together and the lanes are reduced as a binary
+        tree: lane @c j is added to lane @c j+8, then @c j+4, @c j+2 and
+        @c j+1. Narrower instruction sets emulate the 16-lane accumulators
+        using several vectors, thus the cost is low.
+
+        The result is reproducible only if the floating-point arithmetic
+        conforms to IEEE 754, which is not the case e.g. for 32-bit ARM NEON
+        that flushes denormals to zero.
+    */
+    deterministic
+};
+
+namespace detail {
+
+// Whether min and max of 64-bit integer vectors are implemented
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+#define SIMDPP_DETAIL_REDUCE_MINMAX_I64 1
+#else
+#define SIMDPP_DETAIL_REDUCE_MINMAX_I64 0
+#endif
+
+template<class T> struct reduce_minmax_vec : std::true_type {};
+#if !SIMDPP_DETAIL_REDUCE_MINMAX_I64
+template<> struct reduce_minmax_vec<int64_t> : std::false_type {};
+template<> struct reduce_minmax_vec<uint64_t> : std::false_type {};
+#endif
+
+/*  Converts the loaded elements to the accumulator type. The sums and
+    products of 8 and 16-bit elements are accumulated in 16 and 32-bit
+    elements respectively.
+*/
+template<class A, class T> struct reduce_conv {
+    template<class V> static SIMDPP_INL V apply(const V& v) { return v; }
+};
+template<> struct reduce_conv<int16_t, int8_t> {
+    template<unsigned N> static SIMDPP_INL int16<N> apply(const int8<N>& v) { return to_int16(v); }
+};
+template<> struct reduce_conv<uint16_t, uint8_t> {
+    template<unsigned N> static SIMDPP_INL uint16<N> apply(const uint8<N>& v) { return to_uint16(v); }
+};
+template<> struct reduce_conv<int32_t, int16_t> {
+    template<unsigned N> static SIMDPP_INL int32<N> apply(const int16<N>& v) { return to_int32(v); }
+};
+template<> struct reduce_conv<uint32_t, uint16_t> {
+    template<unsigned N> static SIMDPP_INL uint32<N> apply(const uint16<N>& v) { return to_uint32(v); }
+};
+
+struct reduce_op_add {
+    template<class T> static T identity() { return T(0); }
+    template<class V> static SIMDPP_INL V combine(const V& a, const V& b) { return add(a, b); }
+    template<class V> static SIMDPP_INL auto finish(const V& a) -> decltype(reduce_add(a))
+    {
+        return reduce_add(a);
+    }
+};
+
+struct reduce_op_mul {
+    template<class T> static T identity() { return T(1); }
+
+    template<class V> static SIMDPP_INL V combine(const V& a, const V& b) { return mul(a, b); }
+    template<unsigned N> static SIMDPP_INL int16<N> combine(const int16<N>& a, const int16<N>& b) { return mul_lo(a, b); }
+    template<unsigned N> static SIMDPP_INL uint16<N> combine(const uint16<N>& a, const uint16<N>& b) { return mul_lo(a, b); }
+    template<unsigned N> static SIMDPP_INL int32<N> combine(const int32<N>& a, const int32<N>& b) { return mul_lo(a, b); }
+    template<unsigned N> static SIMDPP_INL uint32<N> combine(const uint32<N>& a, const uint32<N>& b) { return mul_lo(a, b); }
+    template<unsigned N> static SIMDPP_INL int64<N> combine(const int64<N>& a, const int64<N>& b)
+    {
+        return int64<N>(i_mul_lo_u64(uint64<N>(a), uint64<N>(b)));
+    }
+    template<unsigned N> static SIMDPP_INL uint64<N> combine(const uint64<N>& a, const uint64<N>& b)
+    {
+        return i_mul_lo_u64(a, b);
+    }
+
+    template<class V> static SIMDPP_INL auto finish(const V& a) -> decltype(reduce_mul(a))
+    {
+        return reduce_mul(a);
+    }
+    template<unsigned N> static SIMDPP_INL int64_t finish(const int64<N>& a)
+    {
+        return int64_t(finish(uint64<N>(a)));
+    }
+    template<unsigned N> static SIMDPP_INL uint64_t finish(const uint64<N>& a)
+    {
+        mem_block<uint64<N>> m(a);
+        uint64_t r = 1;
+        for (unsigned i = 0; i < N; ++i) {
+            r *= m[i];
+        }
+        return r;
+    }
+};
+
+struct reduce_op_min {
+    template<class T> static T identity()
+    {
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::max();
+    }
+    template<class V> static SIMDPP_INL V combine(const V& a, const V& b) { return min(a, b); }
+    template<class T> static SIMDPP_INL T combine_scalar(T a, T b) { return b < a ? b : a; }
+    template<class V> static SIMDPP_INL auto finish(const V& a) -> decltype(reduce_min(a))
+    {
+        return reduce_min(a);
+    }
+};
+
+struct reduce_op_max {
+    template<class T> static T identity()
+    {
+        return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::lowest();
+    }
+    template<class V> static SIMDPP_INL V combine(const V& a, const V& b) { return max(a, b); }
+    template<class T> static SIMDPP_INL T combine_scalar(T a, T b) { return a < b ? b : a; }
+    template<class V> static SIMDPP_INL auto finish(const V& a) -> decltype(reduce_max(a))
+    {
+        return reduce_max(a);
+    }
+};
+
+// Loads count < N elements to a vector padding the rest with @a fill
+template<unsigned N, class T> SIMDPP_INL
+typename array_vec<T, N>::type reduce_load_partial(const T* p, std::size_t count, T fill)
+{
+    SIMDPP_ALIGN(N * sizeof(T)) T buf[N];
+    for (unsigned i = 0; i < N; ++i) {
+        buf[i] = i < count ? p[i] : fill;
+    }
+    return load(buf);
+}
+
+/*  Reduces an array of elements of type T by accumulating them in elements of
+    type A. Four independent accumulators are used so that the latency of the
+    combining operation is hidden.
+*/
+template<class Op, class A, class T> SIMDPP_INL
+A reduce_array(const T* p, std::size_t n)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using VT = typename array_vec<T, L>::type;
+    using VA = typename array_vec<A, L>::type;
+    using C = reduce_conv<A, T>;
+
+    VA acc0 = splat(Op::template identity<A>());
+    VA acc1 = acc0, acc2 = acc0, acc3 = acc0;
+
+    std::size_t i = 0;
+    for (; i + 4*L <= n; i += 4*L) {
+        array_prefetch(p + i);
+        acc0 = Op::combine(acc0, VA(C::apply(VT(load_u(p + i)))));
+        acc1 = Op::combine(acc1, VA(C::apply(VT(load_u(p + i + L)))));
+        acc2 = Op::combine(acc2, VA(C::apply(VT(load_u(p + i + 2*L)))));
+        acc3 = Op::combine(acc3, VA(C::apply(VT(load_u(p + i + 3*L)))));
+    }
+    for (; i + L <= n; i += L) {
+        acc0 = Op::combine(acc0, VA(C::apply(VT(load_u(p + i)))));
+    }
+    if (i < n) {
+        VT v = reduce_load_partial<L>(p + i, n - i, Op::template identity<T>());
+        acc1 = Op::combine(acc1, VA(C::apply(v)));
+    }
+
+    VA acc = Op::combine(Op::combine(acc0, acc1), Op::combine(acc2, acc3));
+    return A(Op::finish(acc));
+}
+
+/*  Computes s = fl(a + b) and the rounding error e, so that s + e == a + b
+    exactly (Knuth's TwoSum). Doesn't need the magnitudes of a and b to be
+    ordered. @a s may refer to the same object as @a a or @a b.
+*/
+template<class V> SIMDPP_INL
+void two_sum(V a, V b, V& s, V& e)
+{
+    V r = add(a, b);
+    V bb = sub(r, a);
+    e = add(sub(a, sub(r, bb)), sub(b, bb));
+    s = r;
+}
+
+template<class T> SIMDPP_INL
+void two_sum_scalar(T a, T b, T& s, T& e)
+{
+    s = a + b;
+    T bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+}
+
+template<class T> struct split_factor;
+template<> struct split_factor<float> { static float value() { return 4097.0f; } };
+template<> struct split_factor<double> { static double value() { return 134217729.0; } };
+
+/*  Computes p = fl(a * b) and the rounding error e, so that p + e == a * b
+    exactly. Uses a fused multiply-subtract if available and Dekker's
+    algorithm otherwise.
+*/
+template<class V> SIMDPP_INL
+void two_prod(const V& a, const V& b, V& p, V& e)
+{
+    p = mul(a, b);
+#if SIMDPP_DETAIL_HAS_FMA
+    e = fmsub(a, b, p);
+#else
+    using T = typename V::element_type;
+    V f = splat(split_factor<T>::value());
+    V ca = mul(f, a);
+    V ah = sub(ca, sub(ca, a));
+    V al = sub(a, ah);
+    V cb = mul(f, b);
+    V bh = sub(cb, sub(cb, b));
+    V bl = sub(b, bh);
+    e = sub(mul(al, bl), sub(sub(sub(p, mul(ah, bh)), mul(al, bh)), mul(ah, bl)));
+#endif
+}
+
+/*  Adds the lanes of the sums @a s and of the accumulated errors @a c. The
+    rounding errors of the additions of the sums are accumulated too.
+*/
+template<class V> SIMDPP_INL
+typename V::element_type sum_lanes_compensated(const V& s0, const V& s1,
+                                               const V& c0, const V& c1)
+{
+    using T = typename V::element_type;
+    mem_block<V> ms0(s0), ms1(s1), mc0(c0), mc1(c1);
+    T s = 0, c = 0, e;
+    for (unsigned j = 0; j < V::length; ++j) {
+        two_sum_scalar(s, ms0[j], s, e);
+        c += e;
+        two_sum_scalar(s, ms1[j], s, e);
+        c += e;
+        c += mc0[j] + mc1[j];
+    }
+    return s + c;
+}
+
+/*  The Sum2 algorithm of Ogita, Rump and Oishi. The result is as accurate as
+    if it was computed in twice the working precision and then rounded.
+*/
+template<class T> SIMDPP_INL
+T sum_compensated_impl(const T* p, std::size_t n)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+
+    V s0 = make_zero(), s1 = s0, c0 = s0, c1 = s0, e0, e1;
+
+    std::size_t i = 0;
+    for (; i + 2*L <= n; i += 2*L) {
+        array_prefetch(p + i);
+        two_sum(s0, V(load_u(p + i)), s0, e0);
+        two_sum(s1, V(load_u(p + i + L)), s1, e1);
+        c0 = add(c0, e0);
+        c1 = add(c1, e1);
+    }
+    for (; i + L <= n; i += L) {
+        two_sum(s0, V(load_u(p + i)), s0, e0);
+        c0 = add(c0, e0);
+    }
+    if (i < n) {
+        two_sum(s1, V(reduce_load_partial<L>(p + i, n - i, T(0))), s1, e1);
+        c1 = add(c1, e1);
+    }
+    return sum_lanes_compensated(s0, s1, c0, c1);
+}
+
+/*  The Dot2 algorithm of Ogita, Rump and Oishi. The result is as accurate as
+    if it was computed in twice the working precision and then rounded.
+*/
+template<class T> SIMDPP_INL
+T dot_compensated_impl(const T* a, const T* b, std::size_t n)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+
+    V s0 = make_zero(), s1 = s0, c0 = s0, c1 = s0;
+    V h0, h1, r0, r1, q0, q1;
+
+    std::size_t i = 0;
+    for (; i + 2*L <= n; i += 2*L) {
+        array_prefetch(a + i);
+        array_prefetch(b + i);
+        two_prod(V(load_u(a + i)), V(load_u(b + i)), h0, r0);
+        two_prod(V(load_u(a + i + L)), V(load_u(b + i + L)), h1, r1);
+        two_sum(s0, h0, s0, q0);
+        two_sum(s1, h1, s1, q1);
+        c0 = add(c0, add(q0, r0));
+        c1 = add(c1, add(q1, r1));
+    }
+    for (; i + L <= n; i += L) {
+        two_prod(V(load_u(a + i)), V(load_u(b + i)), h0, r0);
+        two_sum(s0, h0, s0, q0);
+        c0 = add(c0, add(q0, r0));
+    }
+    if (i < n) {
+        V va = reduce_load_partial<L>(a + i, n - i, T(0));
+        V vb = reduce_load_partial<L>(b + i, n - i, T(0));
+        two_prod(va, vb, h1, r1);
+        two_sum(s1, h1, s1, q1);
+        c1 = add(c1, add(q1, r1));
+    }
+    return sum_lanes_compensated(s0, s1, c0, c1);
+}
+
+// The number of lanes of the accumulators of reduce_mode::deterministic
+static const unsigned reduce_det_lanes = 16;
+
+/*  Sums the elements in the order documented for reduce_mode::deterministic.
+    The vectors of 16 elements are split into native vectors by the library
+    when needed, which doesn't change the lane-wise order of the additions.
+*/
+template<class T> SIMDPP_INL
+T sum_deterministic_impl(const T* p, std::size_t n)
+{
+    const unsigned L = reduce_det_lanes;
+    using V = typename array_vec<T, L>::type;
+
+    V acc0 = make_zero(), acc1 = acc0;
+
+    std::size_t i = 0;
+    for (; i + 2*L <= n; i += 2*L) {
+        array_prefetch(p + i);
+        acc0 = add(acc0, V(load_u(p + i)));
+        acc1 = add(acc1, V(load_u(p + i + L)));
+    }
+    if (i + L <= n) {
+        acc0 = add(acc0, V(load_u(p + i)));
+        i += L;
+        if (i < n) {
+            acc1 = add(acc1, V(reduce_load_partial<L>(p + i, n - i, T(0))));
+        }
+    } else if (i < n) {
+        acc0 = add(acc0, V(reduce_load_partial<L>(p + i, n - i, T(0))));
+    }
+
+    mem_block<V> m(add(acc0, acc1));
+    for (unsigned w = L / 2; w > 0; w /= 2) {
+        for (unsigned j = 0; j < w; ++j) {
+            m[j] = m[j] + m[j + w];
+        }
+    }
+    return m[0];
+}
+
+template<class T> SIMDPP_INL
+T reduce_add_float(const T* p, std::size_t n, reduce_mode mode)
+{
+    if (mode == reduce_mode::compensated) {
+        return sum_compensated_impl(p, n);
+    }
+    if (mode == reduce_mode::deterministic) {
+        return sum_deterministic_impl(p, n);
+    }
+    return reduce_array<reduce_op_add, T>(p, n);
+}
+
+template<class T> struct reduce_uint;
+template<> struct reduce_uint<int8_t>   { using type = uint8_t; };
+template<> struct reduce_uint<uint8_t>  { using type = uint8_t; };
+template<> struct reduce_uint<int16_t>  { using type = uint16_t; };
+template<> struct reduce_uint<uint16_t> { using type = uint16_t; };
+template<> struct reduce_uint<int32_t>  { using type = uint32_t; };
+template<> struct reduce_uint<uint32_t> { using type = uint32_t; };
+template<> struct reduce_uint<int64_t>  { using type = uint64_t; };
+template<> struct reduce_uint<uint64_t> { using type = uint64_t; };
+template<> struct reduce_uint<float>    { using type = uint32_t; };
+template<> struct reduce_uint<double>   { using type = uint64_t; };
+
+template<unsigned N> SIMDPP_INL
+mask_int32<N> reduce_int_mask(const mask_float32<N>& m) { return bit_cast<mask_int32<N>>(m); }
+template<unsigned N> SIMDPP_INL
+mask_int64<N> reduce_int_mask(const mask_float64<N>& m) { return bit_cast<mask_int64<N>>(m); }
+template<class M> SIMDPP_INL
+const M& reduce_int_mask(const M& m) { return m; }
+
+// Returns whether any element of @a a is equal to the corresponding element of @a b
+template<class T, class V> SIMDPP_INL
+bool reduce_any_equal(const V& a, const V& b)
+{
+    using U = typename array_vec<typename reduce_uint<T>::type, V::length>::type;
+    return test_bits_any(U(reduce_int_mask(cmp_eq(a, b))));
+}
+
+template<class T> SIMDPP_INL
+const T* find_first_equal(const T* p, std::size_t n, T x)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+    V vx = splat(x);
+
+    std::size_t i = 0;
+    for (; i + L <= n; i += L) {
+        if (reduce_any_equal<T>(V(load_u(p + i)), vx)) {
+            break;
+        }
+    }
+    for (; i < n; ++i) {
+        if (p[i] == x) {
+            return p + i;
+        }
+    }
+    return p + n;
+}
+
+template<class T> SIMDPP_INL
+const T* find_last_equal(const T* p, std::size_t n, T x)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+    V vx = splat(x);
+
+    std::size_t i = n;
+    for (; i >= L; i -= L) {
+        if (reduce_any_equal<T>(V(load_u(p + i - L)), vx)) {
+            break;
+        }
+    }
+    for (; i > 0; --i) {
+        if (p[i - 1] == x) {
+            return p + i - 1;
+        }
+    }
+    return p + n;
+}
+
+template<class Op, class T> SIMDPP_INL
+T reduce_minmax(const T* p, std::size_t n, std::true_type)
+{
+    return reduce_array<Op, T>(p, n);
+}
+
+template<class Op, class T> SIMDPP_INL
+T reduce_minmax(const T* p, std::size_t n, std::false_type)
+{
+    T r = Op::template identity<T>();
+    for (std::size_t i = 0; i < n; ++i) {
+        r = Op::combine_scalar(r, p[i]);
+    }
+    return r;
+}
+
+template<class T> SIMDPP_INL
+void minmax_values(const T* p, std::size_t n, T& vmin, T& vmax, std::false_type)
+{
+    vmin = p[0];
+    vmax = p[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        vmin = p[i] < vmin ? p[i] : vmin;
+        vmax = vmax < p[i] ? p[i] : vmax;
+    }
+}
+
+template<class T> SIMDPP_INL
+void minmax_values(const T* p, std::size_t n, T& vmin, T& vmax, std::true_type)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+
+    V mn0 = splat(p[0]), mn1 = mn0, mx0 = mn0, mx1 = mn0;
+    std::size_t i = 0;
+    for (; i + 2*L <= n; i += 2*L) {
+        array_prefetch(p + i);
+        V v0 = load_u(p + i);
+        V v1 = load_u(p + i + L);
+        mn0 = min(mn0, v0);
+        mx0 = max(mx0, v0);
+        mn1 = min(mn1, v1);
+        mx1 = max(mx1, v1);
+    }
+    for (; i + L <= n; i += L) {
+        V v = load_u(p + i);
+        mn0 = min(mn0, v);
+        mx0 = max(mx0, v);
+    }
+    vmin = reduce_min(V(min(mn0, mn1)));
+    vmax = reduce_max(V(max(mx0, mx1)));
+    for (; i < n; ++i) {
+        vmin = p[i] < vmin ? p[i] : vmin;
+        vmax = vmax < p[i] ? p[i] : vmax;
+    }
+}
+
+template<class T> SIMDPP_INL
+std::pair<const T*, const T*> minmax_element_impl(const T* p, std::size_t n)
+{
+    if (n == 0) {
+        return std::make_pair(p, p);
+    }
+
+    // Find the values first and then their positions. This is faster than
+    // tracking the indices of the elements in the vector loop.
+    T vmin, vmax;
+    minmax_values(p, n, vmin, vmax, reduce_minmax_vec<T>());
+    return std::make_pair(find_first_equal(p, n, vmin),
+                          find_last_equal(p, n, vmax));
+}
+
+} // namespace detail
+
+/** Computes the sum of @a n elements at @a p. The pointer doesn't need to be
+    aligned. The sums of 8, 16, 32 and 64-bit integers are computed modulo
+    2^16, 2^32, 2^32 and 2^64 respectively, i.e. the result type is the same as
+    that of the @c reduce_add() overload for vectors of the same element type.
+
+    The elements are accumulated in four independent vector accumulators,
+    thus the latency of the additions doesn't limit the throughput. For
+    floating-point arrays the order of the additions is different from that
+    of a sequential loop and depends on the vector width of the target
+    architecture. @a mode selects whether the rounding errors are compensated
+    or whether the order is fixed so that the results are reproducible
+    across architectures.
+*/
+static inline int16_t reduce_add(const int8_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, int16_t>(p, n);
+}
+
+static inline uint16_t reduce_add(const uint8_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, uint16_t>(p, n);
+}
+
+static inline int32_t reduce_add(const int16_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, int32_t>(p, n);
+}
+
+static inline uint32_t reduce_add(const uint16_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, uint32_t>(p, n);
+}
+
+static inline int32_t reduce_add(const int32_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, int32_t>(p, n);
+}
+
+static inline uint32_t reduce_add(const uint32_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, uint32_t>(p, n);
+}
+
+static inline int64_t reduce_add(const int64_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, int64_t>(p, n);
+}
+
+static inline uint64_t reduce_add(const uint64_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_add, uint64_t>(p, n);
+}
+
+static inline float reduce_add(const float* p, std::size_t n,
+                               reduce_mode mode = reduce_mode::fast)
+{
+    return detail::reduce_add_float(p, n, mode);
+}
+
+static inline double reduce_add(const double* p, std::size_t n,
+                                reduce_mode mode = reduce_mode::fast)
+{
+    return detail::reduce_add_float(p, n, mode);
+}
+
+/** Computes the sum of @a n elements at @a p using compensated summation.
+    The pointer doesn't need to be aligned.
+
+    The rounding error of each addition is computed exactly using the TwoSum
+    algorithm and accumulated separately. The result is as accurate as if the
+    sum was computed in twice the working precision and then rounded to the
+    working precision, e.g. it is close to the sum computed in @c double
+    precision for @c float input. About 3 times slower than @c reduce_add().
+
+    The code must not be compiled with options that allow reassociation of
+    floating-point operations, such as @c -ffast-math.
+*/
+static inline float sum_compensated(const float* p, std::size_t n)
+{
+    return detail::sum_compensated_impl(p, n);
+}
+
+static inline double sum_compensated(const double* p, std::size_t n)
+{
+    return detail::sum_compensated_impl(p, n);
+}
+
+/** Computes the dot product of the arrays @a a and @a b of @a n elements using
+    compensated arithmetic. The pointers don't need to be aligned.
+
+    @code
+    r = a[0] * b[0] + a[1] * b[1] + ... + a[n-1] * b[n-1]
+    @endcode
+
+    The rounding errors of the products and of the additions are computed
+    exactly and accumulated separately. The rounding errors of the products
+    are computed using @c fmsub() on architectures that support fused
+    multiply-add and using Dekker's algorithm otherwise. The result is as
+    accurate as if it was computed in twice the working precision and then
+    rounded to the working precision.
+
+    The code must not be compiled with options that allow reassociation or
+    contraction of floating-point operations, such as @c -ffast-math.
+*/
+static inline float dot_compensated(const float* a, const float* b, std::size_t n)
+{
+    return detail::dot_compensated_impl(a, b, n);
+}
+
+static inline double dot_compensated(const double* a, const double* b, std::size_t n)
+{
+    return detail::dot_compensated_impl(a, b, n);
+}
+
+/** Computes the product of @a n elements at @a p. The pointer doesn't need to
+    be aligned. The products of 8, 16, 32 and 64-bit integers are computed
+    modulo 2^16, 2^32, 2^32 and 2^64 respectively. Returns 1 if @a n is zero.
+*/
+static inline int16_t reduce_mul(const int8_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, int16_t>(p, n);
+}
+
+static inline uint16_t reduce_mul(const uint8_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, uint16_t>(p, n);
+}
+
+static inline int32_t reduce_mul(const int16_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, int32_t>(p, n);
+}
+
+static inline uint32_t reduce_mul(const uint16_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, uint32_t>(p, n);
+}
+
+static inline int32_t reduce_mul(const int32_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, int32_t>(p, n);
+}
+
+static inline uint32_t reduce_mul(const uint32_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, uint32_t>(p, n);
+}
+
+static inline int64_t reduce_mul(const int64_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, int64_t>(p, n);
+}
+
+static inline uint64_t reduce_mul(const uint64_t* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, uint64_t>(p, n);
+}
+
+static inline float reduce_mul(const float* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, float>(p, n);
+}
+
+static inline double reduce_mul(const double* p, std::size_t n)
+{
+    return detail::reduce_array<detail::reduce_op_mul, double>(p, n);
+}
+
+/** Computes the minimum of @a n elements at @a p. The pointer doesn't need to
+    be aligned. Returns the largest value of the type, or positive infinity
+    for floating-point types, if @a n is zero. The result is unspecified if
+    the array contains NaN values.
+*/
+template<class T> SIMDPP_INL
+T reduce_min(const T* p, std::size_t n)
+{
+    return detail::reduce_minmax<detail::reduce_op_min>(p, n, detail::reduce_minmax_vec<T>());
+}
+
+/** Computes the maximum of @a n elements at @a p. The pointer doesn't need to
+    be aligned. Returns the smallest value of the type, or negative infinity
+    for floating-point types, if @a n is zero. The result is unspecified if
+    the array contains NaN values.
+*/
+template<class T> SIMDPP_INL
+T reduce_max(const T* p, std::size_t n)
+{
+    return detail::reduce_minmax<detail::reduce_op_max>(p, n, detail::reduce_minmax_vec<T>());
+}
+
+/** Finds the smallest and the largest elements in the array of @a n elements
+    at @a p. The result is the same as of @c std::minmax_element, i.e. the
+    first smallest and the last largest element are returned, and both
+    pointers are equal to @a p if @a n is zero. The result is unspecified if
+    the array contains NaN values.
+
+    The values of the extremes are found first and then their positions are
+    found in a separate search that usually stops early.
+*/
+template<class T> SIMDPP_INL
+std::pair<const T*, const T*> minmax_element(const T* p, std::size_t n)
+{
+    return detail::minmax_element_impl(p, n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_REDUCE_H
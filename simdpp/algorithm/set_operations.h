@@ -0,0 +1,367 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_SET_OPERATIONS_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_SET_OPERATIONS_H
+
+#include <simdpp/simd.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+template<class T> struct set_vec;
+template<> struct set_vec<uint32_t> { using type = uint32<4>; };
+template<> struct set_vec<uint64_t> { using type = uint64<2>; };
+
+/*  Compares each element of @a a with all elements of @a b by comparing @a a
+    with all rotations of @a b. Returns a bit mask with bit i set if element i
+    of @a a is present in @a b.
+*/
+static SIMDPP_INL unsigned set_match_all_pairs(const uint32<4>& a, const uint32<4>& b)
+{
+    mask_int32<4> m0 = cmp_eq(a, b);
+    mask_int32<4> m1 = cmp_eq(a, permute4<1,2,3,0>(b));
+    mask_int32<4> m2 = cmp_eq(a, permute4<2,3,0,1>(b));
+    mask_int32<4> m3 = cmp_eq(a, permute4<3,0,1,2>(b));
+    uint32<4> m = uint32<4>(bit_or(bit_or(m0, m1), bit_or(m2, m3)));
+    return extract_bits_any(m);
+}
+
+static SIMDPP_INL unsigned set_match_all_pairs(const uint64<2>& a, const uint64<2>& b)
+{
+    mask_int64<2> m0 = cmp_eq(a, b);
+    mask_int64<2> m1 = cmp_eq(a, permute2<1,0>(b));
+    uint64<2> m = uint64<2>(bit_or(m0, m1));
+    return extract_bits_any(m);
+}
+
+/*  Stores the elements of @a a whose bits are set in @a bits contiguously to
+    @a out. Returns the number of stored elements. Nothing is written past the
+    stored elements.
+*/
+static SIMDPP_INL std::size_t set_compact_store(uint32_t* out, const uint32<4>& a,
+                                                unsigned bits)
+{
+#if SIMDPP_USE_AVX512F && SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi32(out, bits, a.native());
+    return (bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + (bits >> 3);
+#else
+    uint32_t el[4];
+    store_u(el, a);
+    std::size_t n = 0;
+    for (unsigned i = 0; i < 4; ++i) {
+        if (bits & (1u << i)) {
+            out[n++] = el[i];
+        }
+    }
+    return n;
+#endif
+}
+
+static SIMDPP_INL std::size_t set_compact_store(uint64_t* out, const uint64<2>& a,
+                                                unsigned bits)
+{
+#if SIMDPP_USE_AVX512F && SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi64(out, bits, a.native());
+    return (bits & 1) + (bits >> 1);
+#else
+    uint64_t el[2];
+    store_u(el, a);
+    std::size_t n = 0;
+    for (unsigned i = 0; i < 2; ++i) {
+        if (bits & (1u << i)) {
+            out[n++] = el[i];
+        }
+    }
+    return n;
+#endif
+}
+
+/*  Intersects a short list with a much longer one. For each element of the
+    short list the position in the long list is found by exponential and then
+    binary search down to a block of 4 vectors, which is then compared with
+    the broadcast element.
+*/
+template<class T> SIMDPP_INL
+std::size_t set_intersection_galloping(const T* small, std::size_t ns,
+                                       const T* large, std::size_t nl, T* out)
+{
+    using V = typename set_vec<T>::type;
+    const std::size_t block = 4 * V::length;
+
+    std::size_t n = 0;
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < ns; ++i) {
+        T x = small[i];
+        if (nl == 0 || large[nl - 1] < x) {
+            break;
+        }
+
+        // all elements before lo are less than x, large[hi - 1] is not
+        std::size_t lo = j;
+        std::size_t step = block;
+        while (lo + step < nl && large[lo + step - 1] < x) {
+            lo += step;
+            step *= 2;
+        }
+        std::size_t hi = lo + step < nl ? lo + step : nl;
+        while (hi - lo > block) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (large[mid - 1] < x) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        j = lo;
+
+        bool found;
+        if (hi >= block) {
+            const T* p = large + hi - block;
+            V vx = splat(x);
+            V m0 = V(bit_or(cmp_eq(vx, V(load_u(p))),
+                            cmp_eq(vx, V(load_u(p + V::length)))));
+            V m1 = V(bit_or(cmp_eq(vx, V(load_u(p + 2*V::length))),
+                            cmp_eq(vx, V(load_u(p + 3*V::length)))));
+            found = test_bits_any(bit_or(m0, m1));
+        } else {
+            found = false;
+            for (std::size_t k = lo; k < hi; ++k) {
+                found |= large[k] == x;
+            }
+        }
+        if (found) {
+            out[n++] = x;
+        }
+    }
+    return n;
+}
+
+template<class T> SIMDPP_INL
+std::size_t set_intersection_impl(const T* a, std::size_t na,
+                                  const T* b, std::size_t nb, T* out)
+{
+    using V = typename set_vec<T>::type;
+    const std::size_t L = V::length;
+
+    // Galloping is faster when the sizes of the lists differ a lot
+    if (na * 32 < nb) {
+        return set_intersection_galloping(a, na, b, nb, out);
+    }
+    if (nb * 32 < na) {
+        return set_intersection_galloping(b, nb, a, na, out);
+    }
+
+    std::size_t i = 0, j = 0, n = 0;
+    while (i + L <= na && j + L <= nb) {
+        V va = load_u(a + i);
+        V vb = load_u(b + j);
+        unsigned bits = set_match_all_pairs(va, vb);
+        n += set_compact_store(out + n, va, bits);
+
+        // Elements of va that were matched are smaller than the remaining
+        // elements of b, thus they won't be matched again
+        T amax = a[i + L - 1];
+        T bmax = b[j + L - 1];
+        if (amax <= bmax) {
+            i += L;
+        }
+        if (bmax <= amax) {
+            j += L;
+        }
+    }
+
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            out[n++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return n;
+}
+
+template<class T> SIMDPP_INL
+std::size_t set_difference_impl(const T* a, std::size_t na,
+                                const T* b, std::size_t nb, T* out)
+{
+    using V = typename set_vec<T>::type;
+    const std::size_t L = V::length;
+    const unsigned all_bits = (1u << L) - 1;
+
+    std::size_t i = 0, j = 0, n = 0;
+    // The elements of the current block of a that have been found in b
+    unsigned found = 0;
+    while (i + L <= na && j + L <= nb) {
+        V va = load_u(a + i);
+        V vb = load_u(b + j);
+        found |= set_match_all_pairs(va, vb);
+
+        T amax = a[i + L - 1];
+        T bmax = b[j + L - 1];
+        if (amax <= bmax) {
+            n += set_compact_store(out + n, va, ~found & all_bits);
+            found = 0;
+            i += L;
+        }
+        if (bmax <= amax) {
+            j += L;
+        }
+    }
+
+    // Finish the partially processed block of a, if any
+    if (found != 0) {
+        for (unsigned k = 0; k < L; ++k, ++i) {
+            if (found & (1u << k)) {
+                continue;
+            }
+            while (j < nb && b[j] < a[i]) {
+                j++;
+            }
+            if (j == nb || a[i] < b[j]) {
+                out[n++] = a[i];
+            }
+        }
+    }
+
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            out[n++] = a[i++];
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            i++;
+            j++;
+        }
+    }
+    for (; i < na; ++i) {
+        out[n++] = a[i];
+    }
+    return n;
+}
+
+/*  Merges the lists element by element, except that whole vectors are copied
+    at once when all their elements precede the next element of the other
+    list. Posting lists are frequently clustered, thus this is common.
+*/
+template<class T> SIMDPP_INL
+std::size_t set_union_impl(const T* a, std::size_t na,
+                           const T* b, std::size_t nb, T* out)
+{
+    using V = typename set_vec<T>::type;
+    const std::size_t L = V::length;
+
+    std::size_t i = 0, j = 0, n = 0;
+    while (i < na && j < nb) {
+        if (i + L <= na && a[i + L - 1] < b[j]) {
+            store_u(out + n, V(load_u(a + i)));
+            i += L;
+            n += L;
+        } else if (j + L <= nb && b[j + L - 1] < a[i]) {
+            store_u(out + n, V(load_u(b + j)));
+            j += L;
+            n += L;
+        } else if (a[i] < b[j]) {
+            out[n++] = a[i++];
+        } else if (b[j] < a[i]) {
+            out[n++] = b[j++];
+        } else {
+            out[n++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    for (; i < na; ++i) {
+        out[n++] = a[i];
+    }
+    for (; j < nb; ++j) {
+        out[n++] = b[j];
+    }
+    return n;
+}
+
+} // namespace detail
+
+/** Computes the intersection of two sorted sets. The elements of @a a and
+    @a b must be in strictly increasing order, i.e. there must be no
+    duplicates. The result is stored to @a out which must have space for
+    @c min(na,nb) elements. Returns the number of elements in the result.
+
+    The result is the same as of @c std::set_intersection. Lists of similar
+    sizes are intersected by comparing a vector of elements of each list with
+    all rotations of the other and compacting the matching elements. When one
+    list is more than 32 times longer than the other, the elements of the
+    shorter list are searched for in the longer one using galloping search.
+*/
+static inline std::size_t set_intersection(const uint32_t* a, std::size_t na,
+                                           const uint32_t* b, std::size_t nb,
+                                           uint32_t* out)
+{
+    return detail::set_intersection_impl(a, na, b, nb, out);
+}
+
+static inline std::size_t set_intersection(const uint64_t* a, std::size_t na,
+                                           const uint64_t* b, std::size_t nb,
+                                           uint64_t* out)
+{
+    return detail::set_intersection_impl(a, na, b, nb, out);
+}
+
+/** Computes the union of two sorted sets. The elements of @a a and @a b must
+    be in strictly increasing order. The result is stored to @a out which must
+    have space for @c na+nb elements. Returns the number of elements in the
+    result.
+
+    The result is the same as of @c std::set_union.
+*/
+static inline std::size_t set_union(const uint32_t* a, std::size_t na,
+                                    const uint32_t* b, std::size_t nb,
+                                    uint32_t* out)
+{
+    return detail::set_union_impl(a, na, b, nb, out);
+}
+
+static inline std::size_t set_union(const uint64_t* a, std::size_t na,
+                                    const uint64_t* b, std::size_t nb,
+                                    uint64_t* out)
+{
+    return detail::set_union_impl(a, na, b, nb, out);
+}
+
+/** Computes the elements of sorted set @a a that are not present in sorted
+    set @a b. The elements of @a a and @a b must be in strictly increasing
+    order. The result is stored to @a out which must have space for @c na
+    elements. Returns the number of elements in the result.
+
+    The result is the same as of @c std::set_difference.
+*/
+static inline std::size_t set_difference(const uint32_t* a, std::size_t na,
+                                         const uint32_t* b, std::size_t nb,
+                                         uint32_t* out)
+{
+    return detail::set_difference_impl(a, na, b, nb, out);
+}
+
+static inline std::size_t set_difference(const uint64_t* a, std::size_t na,
+                                         const uint64_t* b, std::size_t nb,
+                                         uint64_t* out)
+{
+    return detail::set_difference_impl(a, na, b, nb, out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_SET_OPERATIONS_H
@@ -0,0 +1,490 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_SOA_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_SOA_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/transform.h>
+#include <simdpp/algorithm/transpose.h>
+#include <simdpp/core/aligned_allocator.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+// De-interleaves and interleaves M native vectors using load_packedM and
+// store_packedM. The pointers must be aligned to the vector size.
+template<unsigned M> struct soa_packed;
+
+template<> struct soa_packed<2> {
+    template<class V, class T> static SIMDPP_INL void load(V* v, const T* p)
+    {
+        load_packed2(v[0], v[1], p);
+    }
+    template<class V, class T> static SIMDPP_INL void store(T* p, const V* v)
+    {
+        store_packed2(p, v[0], v[1]);
+    }
+};
+
+template<> struct soa_packed<3> {
+    template<class V, class T> static SIMDPP_INL void load(V* v, const T* p)
+    {
+        load_packed3(v[0], v[1], v[2], p);
+    }
+    template<class V, class T> static SIMDPP_INL void store(T* p, const V* v)
+    {
+        store_packed3(p, v[0], v[1], v[2]);
+    }
+};
+
+template<> struct soa_packed<4> {
+    template<class V, class T> static SIMDPP_INL void load(V* v, const T* p)
+    {
+        load_packed4(v[0], v[1], v[2], v[3], p);
+    }
+    template<class V, class T> static SIMDPP_INL void store(T* p, const V* v)
+    {
+        store_packed4(p, v[0], v[1], v[2], v[3]);
+    }
+};
+
+template<unsigned M, class T> SIMDPP_INL
+void aos_to_soa_scalar(const T* src, std::size_t begin, std::size_t end,
+                       T* const* dst)
+{
+    for (std::size_t i = begin; i < end; ++i) {
+        for (unsigned f = 0; f < M; ++f) {
+            dst[f][i] = src[i * M + f];
+        }
+    }
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void soa_to_aos_scalar(const T* const* src, std::size_t begin, std::size_t end,
+                       T* dst)
+{
+    for (std::size_t i = begin; i < end; ++i) {
+        for (unsigned f = 0; f < M; ++f) {
+            dst[i * M + f] = src[f][i];
+        }
+    }
+}
+
+// 2 to 4 fields: load_packed and store_packed on native vectors
+template<unsigned M, class T> SIMDPP_INL
+void aos_to_soa_packed(const T* src, std::size_t n, T* const* dst)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+
+    bool aligned = reinterpret_cast<std::uintptr_t>(src) % sizeof(V) == 0;
+    SIMDPP_ALIGN(sizeof(V)) T buf[M * L];
+    V v[M];
+
+    std::size_t i = 0;
+    for (; i + L <= n; i += L) {
+        const T* p = src + i * M;
+        if (!aligned) {
+            std::memcpy(buf, p, sizeof(buf));
+            p = buf;
+        }
+        soa_packed<M>::load(v, p);
+        for (unsigned f = 0; f < M; ++f) {
+            store_u(dst[f] + i, v[f]);
+        }
+    }
+    aos_to_soa_scalar<M>(src, i, n, dst);
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void soa_to_aos_packed(const T* const* src, std::size_t n, T* dst)
+{
+    const unsigned L = array_fast_size<T>::value;
+    using V = typename array_vec<T, L>::type;
+
+    bool aligned = reinterpret_cast<std::uintptr_t>(dst) % sizeof(V) == 0;
+    SIMDPP_ALIGN(sizeof(V)) T buf[M * L];
+    V v[M];
+
+    std::size_t i = 0;
+    for (; i + L <= n; i += L) {
+        for (unsigned f = 0; f < M; ++f) {
+            v[f] = load_u(src[f] + i);
+        }
+        if (aligned) {
+            soa_packed<M>::store(dst + i * M, v);
+        } else {
+            soa_packed<M>::store(buf, v);
+            std::memcpy(dst + i * M, buf, sizeof(buf));
+        }
+    }
+    soa_to_aos_scalar<M>(src, i, n, dst);
+}
+
+/*  5 to 8 fields: B records at a time are transposed in groups of B fields
+    using the 128-bit transpose kernels, which are chains of zip operations.
+    The B elements loaded from each record overlap the next record when M is
+    not a multiple of B, thus the vector loop stops before the loads would
+    pass the end of the array.
+*/
+template<unsigned M, class T> SIMDPP_INL
+std::size_t soa_block_end(std::size_t n)
+{
+    const std::size_t B = transpose_block<T>::size;
+    const std::size_t G = (M + B - 1) / B;
+    // the last element accessed by the block at i is (i + B - 1)*M + G*B - 1
+    std::size_t i = 0;
+    if (n * M >= G * B + (B - 1) * M) {
+        i = (n * M - G * B - (B - 1) * M) / (B * M) * B + B;
+    }
+    return i;
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void aos_to_soa_transpose(const T* src, std::size_t n, T* const* dst)
+{
+    const unsigned B = transpose_block<T>::size;
+    const unsigned G = (M + B - 1) / B;
+    using V = typename array_vec<T, B>::type;
+    SIMDPP_ALIGN(16) T buf[B * B];
+
+    std::size_t end = soa_block_end<M, T>(n);
+    for (std::size_t i = 0; i < end; i += B) {
+        for (unsigned g = 0; g < G; ++g) {
+            // buf[f*B + r] = src[(i+r)*M + g*B + f]
+            transpose_block<T>::template apply<false>(src + i * M + g * B, M, buf, B);
+            for (unsigned f = 0; f < B && g * B + f < M; ++f) {
+                store_u(dst[g * B + f] + i, V(load(buf + f * B)));
+            }
+        }
+    }
+    aos_to_soa_scalar<M>(src, end, n, dst);
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void soa_to_aos_transpose(const T* const* src, std::size_t n, T* dst)
+{
+    const unsigned B = transpose_block<T>::size;
+    const unsigned G = (M + B - 1) / B;
+    using V = typename array_vec<T, B>::type;
+    SIMDPP_ALIGN(16) T in[B * B];
+    SIMDPP_ALIGN(16) T buf[B * B];
+
+    std::size_t end = soa_block_end<M, T>(n);
+    for (std::size_t i = 0; i < end; i += B) {
+        // The stores of the last group spill past the record into the
+        // following records. These are overwritten by the stores of the
+        // following records and of the lower groups, which come later.
+        for (unsigned g = G; g-- > 0;) {
+            for (unsigned f = 0; f < B; ++f) {
+                V v = make_zero();
+                if (g * B + f < M) {
+                    v = load_u(src[g * B + f] + i);
+                }
+                store(in + f * B, v);
+            }
+            transpose_block<T>::template apply<false>(in, B, buf, B);
+            for (unsigned r = 0; r < B; ++r) {
+                store_u(dst + (i + r) * M + g * B, V(load(buf + r * B)));
+            }
+        }
+    }
+    soa_to_aos_scalar<M>(src, end, n, dst);
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void aos_to_soa_impl(const T* src, std::size_t n, T* const* dst,
+                     std::integral_constant<bool, true> /* packed */)
+{
+    aos_to_soa_packed<M>(src, n, dst);
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void aos_to_soa_impl(const T* src, std::size_t n, T* const* dst,
+                     std::integral_constant<bool, false> /* packed */)
+{
+    aos_to_soa_transpose<M>(src, n, dst);
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void soa_to_aos_impl(const T* const* src, std::size_t n, T* dst,
+                     std::integral_constant<bool, true> /* packed */)
+{
+    soa_to_aos_packed<M>(src, n, dst);
+}
+
+template<unsigned M, class T> SIMDPP_INL
+void soa_to_aos_impl(const T* const* src, std::size_t n, T* dst,
+                     std::integral_constant<bool, false> /* packed */)
+{
+    soa_to_aos_transpose<M>(src, n, dst);
+}
+
+template<unsigned M> struct soa_use_packed :
+    std::integral_constant<bool, (M <= 4)> {};
+
+template<class... T> struct soa_same_size;
+template<class T> struct soa_same_size<T> : std::true_type {};
+template<class T, class U, class... Ts> struct soa_same_size<T, U, Ts...> :
+    std::integral_constant<bool, sizeof(T) == sizeof(U) &&
+                                 soa_same_size<U, Ts...>::value> {};
+
+} // namespace detail
+
+/** Converts @a n records of @a M fields stored in an array of structures at
+    @a src to a structure of arrays: field @c f of record @c i is stored to
+    @c dst[f][i].
+
+    @code
+    for (i = 0; i < n; ++i)
+        for (f = 0; f < M; ++f)
+            dst[f][i] = src[i*M + f]
+    @endcode
+
+    @a M must be between 2 and 8. All fields must have the same size of 1, 2,
+    4 or 8 bytes; records whose fields have different types of the same size
+    can be converted by passing the data as an array of unsigned integers of
+    that size. Records of 2 to 4 fields are de-interleaved using
+    @c load_packed2 to @c load_packed4. Records of 5 to 8 fields are
+    de-interleaved by transposing blocks of records using @c transpose4 and
+    @c transpose2, i.e. chains of @c zip operations. The pointers don't need
+    to be aligned, but the conversion is faster if @a src is aligned to the
+    native vector size.
+*/
+template<unsigned M, class T> SIMDPP_INL
+void aos_to_soa(const T* src, std::size_t n, T* const* dst)
+{
+    static_assert(M >= 2 && M <= 8, "The number of fields must be between 2 and 8");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "Field size must be 1, 2, 4 or 8 bytes");
+    using U = typename detail::transpose_uint<sizeof(T)>::type;
+    U* udst[M];
+    for (unsigned f = 0; f < M; ++f) {
+        udst[f] = reinterpret_cast<U*>(dst[f]);
+    }
+    detail::aos_to_soa_impl<M>(reinterpret_cast<const U*>(src), n, udst,
+                               detail::soa_use_packed<M>());
+}
+
+/** Converts @a n records of @a M fields stored as a structure of arrays at
+    @a src to an array of structures at @a dst. This is the inverse of
+    @c aos_to_soa().
+
+    @code
+    for (i = 0; i < n; ++i)
+        for (f = 0; f < M; ++f)
+            dst[i*M + f] = src[f][i]
+    @endcode
+
+    The requirements are the same as of @c aos_to_soa(). The conversion is
+    faster if @a dst is aligned to the native vector size.
+*/
+template<unsigned M, class T> SIMDPP_INL
+void soa_to_aos(const T* const* src, std::size_t n, T* dst)
+{
+    static_assert(M >= 2 && M <= 8, "The number of fields must be between 2 and 8");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "Field size must be 1, 2, 4 or 8 bytes");
+    using U = typename detail::transpose_uint<sizeof(T)>::type;
+    const U* usrc[M];
+    for (unsigned f = 0; f < M; ++f) {
+        usrc[f] = reinterpret_cast<const U*>(src[f]);
+    }
+    detail::soa_to_aos_impl<M>(usrc, n, reinterpret_cast<U*>(dst),
+                               detail::soa_use_packed<M>());
+}
+
+/** A container that stores records of the given field types as a structure
+    of arrays. Each field is stored in a separate array aligned to 64 bytes,
+    so that the fields of consecutive records can be loaded into vectors
+    with aligned loads.
+
+    @code
+    soa_vector<float, float, float, uint32_t> particles;
+    particles.from_aos(records, n);
+    float* x = particles.data<0>();
+    @endcode
+*/
+template<class... Fields>
+class soa_vector {
+public:
+    /// The number of fields in each record
+    static const unsigned num_fields = sizeof...(Fields);
+
+    /// The alignment of the arrays of the fields in bytes
+    static const std::size_t alignment = 64;
+
+    /// The type of the field @a I
+    template<unsigned I>
+    using field_type = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+    soa_vector() = default;
+
+    /// Creates a container of @a n value-initialized records
+    explicit soa_vector(std::size_t n) { resize(n); }
+
+    /// Returns the number of records
+    std::size_t size() const { return std::get<0>(fields_).size(); }
+
+    /// Returns @c true if the container doesn't contain any records
+    bool empty() const { return size() == 0; }
+
+    /// Changes the number of records to @a n
+    void resize(std::size_t n)
+    {
+        for_each_field([n](auto& v) { v.resize(n); });
+    }
+
+    /// Allocates space for at least @a n records
+    void reserve(std::size_t n)
+    {
+        for_each_field([n](auto& v) { v.reserve(n); });
+    }
+
+    /// Removes all records
+    void clear()
+    {
+        for_each_field([](auto& v) { v.clear(); });
+    }
+
+    /// Appends a record
+    void push_back(const Fields&... values)
+    {
+        push_back_impl(std::index_sequence_for<Fields...>(), values...);
+    }
+
+    /// Returns a pointer to the array of field @a I
+    template<unsigned I> field_type<I>* data()
+    {
+        return std::get<I>(fields_).data();
+    }
+
+    template<unsigned I> const field_type<I>* data() const
+    {
+        return std::get<I>(fields_).data();
+    }
+
+    /// Returns field @a I of the record @a i
+    template<unsigned I> field_type<I>& get(std::size_t i)
+    {
+        return std::get<I>(fields_)[i];
+    }
+
+    template<unsigned I> const field_type<I>& get(std::size_t i) const
+    {
+        return std::get<I>(fields_)[i];
+    }
+
+    /** Replaces the contents of the container with @a n records stored in
+        an array of structures at @a src. The records must consist of the
+        fields in the order of @a Fields without padding. All fields must
+        have the same size, see @c aos_to_soa().
+    */
+    void from_aos(const void* src, std::size_t n)
+    {
+        resize(n);
+        from_aos_impl(src, n, std::index_sequence_for<Fields...>());
+    }
+
+    /// Stores the records to an array of structures at @a dst. The layout
+    /// is the same as for @c from_aos().
+    void to_aos(void* dst) const
+    {
+        to_aos_impl(dst, std::index_sequence_for<Fields...>());
+    }
+
+private:
+    static_assert(sizeof...(Fields) > 0, "At least one field is required");
+
+    template<class F>
+    void for_each_field(F f)
+    {
+        for_each_field_impl(f, std::index_sequence_for<Fields...>());
+    }
+
+    template<class F, std::size_t... Is>
+    void for_each_field_impl(F& f, std::index_sequence<Is...>)
+    {
+        int dummy[] = { (f(std::get<Is>(fields_)), 0)... };
+        (void) dummy;
+    }
+
+    template<std::size_t... Is>
+    void push_back_impl(std::index_sequence<Is...>, const Fields&... values)
+    {
+        int dummy[] = { (std::get<Is>(fields_).push_back(values), 0)... };
+        (void) dummy;
+    }
+
+    template<std::size_t... Is>
+    void from_aos_impl(const void* src, std::size_t n, std::index_sequence<Is...>)
+    {
+        using T = field_type<0>;
+        static_assert(detail::soa_same_size<Fields...>::value,
+                      "All fields must have the same size");
+        using U = typename detail::transpose_uint<sizeof(T)>::type;
+        U* dst[] = { reinterpret_cast<U*>(std::get<Is>(fields_).data())... };
+        copy_from_aos(reinterpret_cast<const U*>(src), n, dst,
+                      std::integral_constant<bool, (num_fields > 1)>());
+    }
+
+    template<std::size_t... Is>
+    void to_aos_impl(void* dst, std::index_sequence<Is...>) const
+    {
+        using T = field_type<0>;
+        static_assert(detail::soa_same_size<Fields...>::value,
+                      "All fields must have the same size");
+        using U = typename detail::transpose_uint<sizeof(T)>::type;
+        const U* src[] = { reinterpret_cast<const U*>(std::get<Is>(fields_).data())... };
+        copy_to_aos(src, size(), reinterpret_cast<U*>(dst),
+                    std::integral_constant<bool, (num_fields > 1)>());
+    }
+
+    template<class U>
+    static void copy_from_aos(const U* src, std::size_t n, U* const* dst,
+                              std::true_type)
+    {
+        aos_to_soa<num_fields>(src, n, dst);
+    }
+
+    template<class U>
+    static void copy_from_aos(const U* src, std::size_t n, U* const* dst,
+                              std::false_type)
+    {
+        std::memcpy(dst[0], src, n * sizeof(U));
+    }
+
+    template<class U>
+    static void copy_to_aos(const U* const* src, std::size_t n, U* dst,
+                            std::true_type)
+    {
+        soa_to_aos<num_fields>(src, n, dst);
+    }
+
+    template<class U>
+    static void copy_to_aos(const U* const* src, std::size_t n, U* dst,
+                            std::false_type)
+    {
+        std::memcpy(dst, src[0], n * sizeof(U));
+    }
+
+    std::tuple<std::vector<Fields, aligned_allocator<Fields, alignment>>...> fields_;
+};
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_SOA_H
@@ -0,0 +1,293 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_TRANSFORM_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_TRANSFORM_H
+
+#include <simdpp/simd.h>
+#include <simdpp/detail/fma.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+// The vector type with N elements of type T
+template<class T, unsigned N> struct array_vec;
+template<unsigned N> struct array_vec<int8_t, N>   { using type = int8<N>; };
+template<unsigned N> struct array_vec<uint8_t, N>  { using type = uint8<N>; };
+template<unsigned N> struct array_vec<int16_t, N>  { using type = int16<N>; };
+template<unsigned N> struct array_vec<uint16_t, N> { using type = uint16<N>; };
+template<unsigned N> struct array_vec<int32_t, N>  { using type = int32<N>; };
+template<unsigned N> struct array_vec<uint32_t, N> { using type = uint32<N>; };
+template<unsigned N> struct array_vec<int64_t, N>  { using type = int64<N>; };
+template<unsigned N> struct array_vec<uint64_t, N> { using type = uint64<N>; };
+template<unsigned N> struct array_vec<float, N>    { using type = float32<N>; };
+template<unsigned N> struct array_vec<double, N>   { using type = float64<N>; };
+
+// The number of elements of type T in the native vector
+template<class T> struct array_fast_size;
+template<> struct array_fast_size<int8_t>   { static const unsigned value = SIMDPP_FAST_INT8_SIZE; };
+template<> struct array_fast_size<uint8_t>  { static const unsigned value = SIMDPP_FAST_INT8_SIZE; };
+template<> struct array_fast_size<int16_t>  { static const unsigned value = SIMDPP_FAST_INT16_SIZE; };
+template<> struct array_fast_size<uint16_t> { static const unsigned value = SIMDPP_FAST_INT16_SIZE; };
+template<> struct array_fast_size<int32_t>  { static const unsigned value = SIMDPP_FAST_INT32_SIZE; };
+template<> struct array_fast_size<uint32_t> { static const unsigned value = SIMDPP_FAST_INT32_SIZE; };
+template<> struct array_fast_size<int64_t>  { static const unsigned value = SIMDPP_FAST_INT64_SIZE; };
+template<> struct array_fast_size<uint64_t> { static const unsigned value = SIMDPP_FAST_INT64_SIZE; };
+template<> struct array_fast_size<float>    { static const unsigned value = SIMDPP_FAST_FLOAT32_SIZE; };
+template<> struct array_fast_size<double>   { static const unsigned value = SIMDPP_FAST_FLOAT64_SIZE; };
+
+/*  The number of elements processed at once when arrays of the given types
+    are processed together. Each of the vectors is at least as wide as the
+    native vector.
+*/
+template<class... T> struct array_step;
+template<class T> struct array_step<T> {
+    static const unsigned value = array_fast_size<T>::value;
+};
+template<class T, class... Ts> struct array_step<T, Ts...> {
+    static const unsigned value =
+        array_fast_size<T>::value > array_step<Ts...>::value ?
+            array_fast_size<T>::value : array_step<Ts...>::value;
+};
+
+// Prefetch distance for the streaming loops
+static const std::size_t array_prefetch_bytes = 512;
+
+template<class T> SIMDPP_INL
+void array_prefetch(const T* p)
+{
+    prefetch_read(reinterpret_cast<const char*>(p) + array_prefetch_bytes);
+}
+
+// Loads count < N elements to a vector padding the rest with zeros
+template<unsigned N, class T> SIMDPP_INL
+typename array_vec<T, N>::type array_load_partial(const T* p, std::size_t count)
+{
+    SIMDPP_ALIGN(N * sizeof(T)) T buf[N];
+    std::memset(buf, 0, sizeof(buf));
+    std::memcpy(buf, p, count * sizeof(T));
+    return load(buf);
+}
+
+template<class T, class V> SIMDPP_INL
+void array_store_partial(T* p, const V& v, std::size_t count)
+{
+    SIMDPP_ALIGN(V::length * sizeof(T)) T buf[V::length];
+    store(buf, v);
+    std::memcpy(p, buf, count * sizeof(T));
+}
+
+// Returns the number of elements to process before @a p becomes aligned to
+// @a align bytes or @a n if that's not possible.
+template<class T> SIMDPP_INL
+std::size_t array_peel_count(const T* p, std::size_t align, std::size_t n)
+{
+    std::size_t misalign = reinterpret_cast<std::uintptr_t>(p) % align;
+    if (misalign == 0) {
+        return 0;
+    }
+    if ((align - misalign) % sizeof(T) != 0) {
+        return n;
+    }
+    std::size_t peel = (align - misalign) / sizeof(T);
+    return peel < n ? peel : n;
+}
+
+template<class... T> SIMDPP_INL void array_ignore(const T&...) {}
+
+/*  Calls f(0), f(1), ..., f(N-1). Loops over arrays of vectors must be
+    unrolled so that the vectors are kept in registers, which compilers don't
+    always do at -O2.
+*/
+template<unsigned I, unsigned N> struct array_unroll_impl {
+    template<class F> static SIMDPP_INL void run(F& f)
+    {
+        f(I);
+        array_unroll_impl<I + 1, N>::run(f);
+    }
+};
+template<unsigned N> struct array_unroll_impl<N, N> {
+    template<class F> static SIMDPP_INL void run(F&) {}
+};
+
+template<unsigned N, class F> SIMDPP_INL
+void array_unroll(F f)
+{
+    array_unroll_impl<0, N>::run(f);
+}
+
+// Computes a * b + c using fused multiply-add if it's available in hardware
+template<class V> SIMDPP_INL
+V array_fmadd(const V& a, const V& b, const V& c)
+{
+#if SIMDPP_DETAIL_HAS_FMA && !SIMDPP_USE_NULL
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+template<class TO, class F, class... TI> SIMDPP_INL
+void transform_impl(TO* out, std::size_t n, F f, const TI*... in)
+{
+    const unsigned N = array_step<TO, TI...>::value;
+    using VO = typename array_vec<TO, N>::type;
+    // aligned stores of VO require alignment to the size of the native vector
+    const std::size_t align = array_fast_size<TO>::value * sizeof(TO);
+
+    std::size_t i = 0;
+
+    // Process a partial vector until the output becomes aligned. If the
+    // output can't be aligned, use unaligned stores throughout.
+    std::size_t peel = array_peel_count(out, align, n);
+    if (peel == n) {
+        for (; i + N <= n; i += N) {
+            VO r = f(typename array_vec<TI, N>::type(load_u(in + i))...);
+            store_u(out + i, r);
+        }
+    } else if (peel != 0) {
+        VO r = f(array_load_partial<N>(in, peel)...);
+        array_store_partial(out, r, peel);
+        i = peel;
+    }
+
+    for (; i + 2*N <= n; i += 2*N) {
+        array_ignore((array_prefetch(in + i), 0)...);
+        VO r0 = f(typename array_vec<TI, N>::type(load_u(in + i))...);
+        VO r1 = f(typename array_vec<TI, N>::type(load_u(in + i + N))...);
+        store(out + i, r0);
+        store(out + i + N, r1);
+    }
+    for (; i + N <= n; i += N) {
+        VO r = f(typename array_vec<TI, N>::type(load_u(in + i))...);
+        store(out + i, r);
+    }
+    if (i < n) {
+        VO r = f(array_load_partial<N>(in + i, n - i)...);
+        array_store_partial(out + i, r, n - i);
+    }
+}
+
+/*  Reduces the elements of a vector by applying the reduction function to
+    single-element vectors. The function only needs to be defined for
+    vectors.
+*/
+template<class V, class R> SIMDPP_INL
+V array_reduce_lanes(const V& v, R r)
+{
+    using T = typename V::element_type;
+    SIMDPP_ALIGN(sizeof(V)) T buf[V::length];
+    store(buf, v);
+    V acc = splat(buf[0]);
+    for (unsigned i = 1; i < V::length; ++i) {
+        acc = r(acc, V(splat(buf[i])));
+    }
+    return acc;
+}
+
+template<class T, class R, class F, class... TI> SIMDPP_INL
+T transform_reduce_impl(std::size_t n, T identity, R r, F f, const TI*... in)
+{
+    const unsigned N = array_step<T, TI...>::value;
+    using V = typename array_vec<T, N>::type;
+
+    V acc0 = splat(identity);
+    V acc1 = acc0;
+    std::size_t i = 0;
+    for (; i + 2*N <= n; i += 2*N) {
+        // two accumulators to hide the latency of the reduction
+        array_ignore((array_prefetch(in + i), 0)...);
+        V v0 = f(typename array_vec<TI, N>::type(load_u(in + i))...);
+        V v1 = f(typename array_vec<TI, N>::type(load_u(in + i + N))...);
+        acc0 = r(acc0, v0);
+        acc1 = r(acc1, v1);
+    }
+    for (; i + N <= n; i += N) {
+        V v = f(typename array_vec<TI, N>::type(load_u(in + i))...);
+        acc0 = r(acc0, v);
+    }
+    if (i < n) {
+        // replace the elements past the end with the identity element
+        V v = f(array_load_partial<N>(in + i, n - i)...);
+        SIMDPP_ALIGN(sizeof(V)) T buf[N];
+        store(buf, v);
+        for (std::size_t j = n - i; j < N; ++j) {
+            buf[j] = identity;
+        }
+        acc1 = r(acc1, V(load(buf)));
+    }
+
+    V acc = array_reduce_lanes(V(r(acc0, acc1)), r);
+    return extract<0>(acc);
+}
+
+} // namespace detail
+
+/** Applies the given function to the elements of the input arrays and stores
+    the results to @a out.
+
+    @code
+    for (i = 0; i < n; i += L)
+        out[i:i+L] = f(in0[i:i+L], in1[i:i+L], ...)
+    @endcode
+
+    @a f is called with vectors of the input element types that contain the
+    same number of elements. The number of elements is the largest native
+    vector size among the input and output types. @a f may return an
+    expression, e.g. @c [](auto a, auto b) { return a * b + b; }, which is
+    evaluated directly into the output vector type.
+
+    The input pointers don't need to be aligned. The main loop is unrolled
+    twice and stores aligned vectors. The elements before the first aligned
+    output position and past the last whole vector are processed in a vector
+    padded with zeros, thus @a f must not have side effects that depend on the
+    number of processed elements. Nothing is read from or written to memory
+    outside the arrays.
+
+    The element types must be 8, 16, 32 or 64-bit integers, @c float or
+    @c double.
+*/
+template<class TO, class F, class... TI> SIMDPP_INL
+void transform(TO* out, std::size_t n, F f, const TI*... in)
+{
+    static_assert(sizeof...(TI) > 0, "At least one input is required");
+    detail::transform_impl(out, n, f, in...);
+}
+
+/** Applies the transform function to the elements of the input arrays and
+    reduces the results using the reduction function.
+
+    @code
+    r = identity
+    for (i = 0; i < n; i += L)
+        r = reduce(r, transform(in0[i:i+L], in1[i:i+L], ...))
+    return reduce(r0, r1, ..., rL)
+    @endcode
+
+    @a transform is called as in @c transform(). @a reduce is called with two
+    vectors of @a T and must be associative and commutative, e.g.
+    @c [](auto a, auto b) { return a + b; } or
+    @c [](auto a, auto b) { return max(a, b); }. @a identity must be the
+    identity element of the reduction, e.g. zero for addition. The order in
+    which the elements are combined is unspecified.
+*/
+template<class T, class R, class F, class... TI> SIMDPP_INL
+T transform_reduce(std::size_t n, T identity, R reduce, F transform, const TI*... in)
+{
+    static_assert(sizeof...(TI) > 0, "At least one input is required");
+    return detail::transform_reduce_impl(n, identity, reduce, transform, in...);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_TRANSFORM_H
@@ -0,0 +1,248 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_TRANSPOSE_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_TRANSPOSE_H
+
+#include <simdpp/simd.h>
+#include <simdpp/dispatch/get_cache_info.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+// The edge of the square tiles in elements if the size of the L1 cache is not
+// known.
+static const std::size_t transpose_tile = 64;
+
+/*  Returns the edge of the square tiles in elements: the largest power of
+    two such that a tile of the source and of the destination fit into L1
+    together. The result is a multiple of the block size @a B.
+*/
+template<class T> SIMDPP_INL
+std::size_t transpose_get_tile(std::size_t B)
+{
+    std::size_t l1 = get_cache_info().l1d_size;
+    if (l1 == 0) {
+        return transpose_tile;
+    }
+    std::size_t tile = B;
+    while (tile < 256 && 2 * (2 * tile) * (2 * tile) * sizeof(T) <= l1) {
+        tile *= 2;
+    }
+    return tile;
+}
+
+// Streaming stores are used if the destination is larger than this
+static const std::size_t transpose_stream_bytes = std::size_t(1) << 22;
+
+template<bool Stream> struct transpose_store;
+template<> struct transpose_store<false> {
+    template<class T, class V> static SIMDPP_INL void apply(T* p, const V& v)
+    {
+        store_u(p, v);
+    }
+};
+template<> struct transpose_store<true> {
+    template<class T, class V> static SIMDPP_INL void apply(T* p, const V& v)
+    {
+        stream(p, v);
+    }
+};
+
+/*  Transposes a square block of 128-bit vectors. The source rows are
+    @a lds elements apart and the destination rows @a ldd elements apart.
+*/
+template<class T> struct transpose_block;
+
+template<> struct transpose_block<uint64_t> {
+    static const unsigned size = 2;
+
+    template<bool S> static SIMDPP_INL
+    void apply(const uint64_t* s, std::size_t lds, uint64_t* d, std::size_t ldd)
+    {
+        uint64<2> r0 = load_u(s), r1 = load_u(s + lds);
+        transpose2(r0, r1);
+        transpose_store<S>::apply(d, r0);
+        transpose_store<S>::apply(d + ldd, r1);
+    }
+};
+
+template<> struct transpose_block<uint32_t> {
+    static const unsigned size = 4;
+
+    template<bool S> static SIMDPP_INL
+    void apply(const uint32_t* s, std::size_t lds, uint32_t* d, std::size_t ldd)
+    {
+        uint32<4> r0 = load_u(s), r1 = load_u(s + lds),
+                  r2 = load_u(s + 2*lds), r3 = load_u(s + 3*lds);
+        transpose4(r0, r1, r2, r3);
+        transpose_store<S>::apply(d, r0);
+        transpose_store<S>::apply(d + ldd, r1);
+        transpose_store<S>::apply(d + 2*ldd, r2);
+        transpose_store<S>::apply(d + 3*ldd, r3);
+    }
+};
+
+/*  8x8 block: the 4x4 sub-blocks are transposed within the halves of the
+    rows, after which the 64-bit halves of the rows i and i+4 are swapped.
+*/
+template<> struct transpose_block<uint16_t> {
+    static const unsigned size = 8;
+
+    template<bool S> static SIMDPP_INL
+    void apply(const uint16_t* s, std::size_t lds, uint16_t* d, std::size_t ldd)
+    {
+        uint16<8> r[8];
+        for (unsigned i = 0; i < 8; ++i) {
+            r[i] = load_u(s + i*lds);
+        }
+        transpose4(r[0], r[1], r[2], r[3]);
+        transpose4(r[4], r[5], r[6], r[7]);
+        for (unsigned i = 0; i < 4; ++i) {
+            uint64<2> lo = uint64<2>(r[i]), hi = uint64<2>(r[i + 4]);
+            transpose2(lo, hi);
+            transpose_store<S>::apply(d + i*ldd, lo);
+            transpose_store<S>::apply(d + (i + 4)*ldd, hi);
+        }
+    }
+};
+
+/*  16x16 block: the 4x4 sub-blocks are transposed within the 32-bit
+    quarters of the rows, after which the quarters of the rows i, i+4, i+8
+    and i+12 are transposed as 32-bit elements.
+*/
+template<> struct transpose_block<uint8_t> {
+    static const unsigned size = 16;
+
+    template<bool S> static SIMDPP_INL
+    void apply(const uint8_t* s, std::size_t lds, uint8_t* d, std::size_t ldd)
+    {
+        uint8<16> r[16];
+        for (unsigned i = 0; i < 16; ++i) {
+            r[i] = load_u(s + i*lds);
+        }
+        for (unsigned i = 0; i < 16; i += 4) {
+            transpose4(r[i], r[i + 1], r[i + 2], r[i + 3]);
+        }
+        for (unsigned i = 0; i < 4; ++i) {
+            uint32<4> q0 = uint32<4>(r[i]), q1 = uint32<4>(r[i + 4]),
+                      q2 = uint32<4>(r[i + 8]), q3 = uint32<4>(r[i + 12]);
+            transpose4(q0, q1, q2, q3);
+            transpose_store<S>::apply(d + i*ldd, q0);
+            transpose_store<S>::apply(d + (i + 4)*ldd, q1);
+            transpose_store<S>::apply(d + (i + 8)*ldd, q2);
+            transpose_store<S>::apply(d + (i + 12)*ldd, q3);
+        }
+    }
+};
+
+template<class T> SIMDPP_INL
+void transpose_scalar(const T* src, std::size_t rows, std::size_t cols, T* dst,
+                      std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1)
+{
+    for (std::size_t c = c0; c < c1; ++c) {
+        for (std::size_t r = r0; r < r1; ++r) {
+            dst[c * rows + r] = src[r * cols + c];
+        }
+    }
+}
+
+template<class T, bool Stream> SIMDPP_INL
+void transpose_tiled(const T* src, std::size_t rows, std::size_t cols, T* dst)
+{
+    const std::size_t B = transpose_block<T>::size;
+    const std::size_t tile = transpose_get_tile<T>(B);
+    std::size_t rows_b = rows / B * B;
+    std::size_t cols_b = cols / B * B;
+
+    for (std::size_t tr = 0; tr < rows_b; tr += tile) {
+        std::size_t tr_end = std::min(tr + tile, rows_b);
+        for (std::size_t tc = 0; tc < cols_b; tc += tile) {
+            std::size_t tc_end = std::min(tc + tile, cols_b);
+            // consecutive blocks are stored to the same destination rows
+            for (std::size_t c = tc; c < tc_end; c += B) {
+                for (std::size_t r = tr; r < tr_end; r += B) {
+                    transpose_block<T>::template apply<Stream>(
+                            src + r * cols + c, cols, dst + c * rows + r, rows);
+                }
+            }
+        }
+    }
+    // the edges that don't fill whole blocks
+    transpose_scalar(src, rows, cols, dst, 0, rows_b, cols_b, cols);
+    transpose_scalar(src, rows, cols, dst, rows_b, rows, 0, cols);
+}
+
+template<class T> SIMDPP_INL
+void transpose_matrix_impl(const T* src, std::size_t rows, std::size_t cols, T* dst)
+{
+    const std::size_t B = transpose_block<T>::size;
+    if (rows < B || cols < B) {
+        transpose_scalar(src, rows, cols, dst, 0, rows, 0, cols);
+        return;
+    }
+
+    // Streaming stores need each destination block to be aligned to 16 bytes
+    bool aligned = reinterpret_cast<std::uintptr_t>(dst) % 16 == 0 &&
+                   (rows * sizeof(T)) % 16 == 0;
+    if (aligned && rows * cols * sizeof(T) > transpose_stream_bytes) {
+        transpose_tiled<T, true>(src, rows, cols, dst);
+#if SIMDPP_USE_SSE2
+        _mm_sfence();
+#endif
+    } else {
+        transpose_tiled<T, false>(src, rows, cols, dst);
+    }
+}
+
+template<unsigned Size> struct transpose_uint;
+template<> struct transpose_uint<1> { using type = uint8_t; };
+template<> struct transpose_uint<2> { using type = uint16_t; };
+template<> struct transpose_uint<4> { using type = uint32_t; };
+template<> struct transpose_uint<8> { using type = uint64_t; };
+
+} // namespace detail
+
+/** Transposes a matrix of @a rows x @a cols elements stored in row-major
+    order at @a src and stores the result, a matrix of @a cols x @a rows
+    elements, to @a dst. The arrays must not overlap and don't need to be
+    aligned.
+
+    @code
+    dst[c*rows + r] = src[r*cols + c]
+    @endcode
+
+    The matrix is traversed in square tiles that fit into the L1 cache, the
+    size of which is retrieved at runtime using @c get_cache_info(). Each
+    tile is transposed in blocks of 128-bit vectors (16x16 8-bit, 8x8
+    16-bit, 4x4 32-bit or 2x2 64-bit elements) using @c transpose4 and
+    @c transpose2. The elements in the last partial block rows and columns
+    are copied one by one. If the destination is larger than 4 MiB and its
+    rows are aligned to 16 bytes, the results are stored with @c stream so
+    that they don't evict the source from the caches.
+
+    @a T must be a trivially copyable type of 1, 2, 4 or 8 bytes, e.g. an
+    integer, @c float or @c double.
+*/
+template<class T> SIMDPP_INL
+void transpose_matrix(const T* src, std::size_t rows, std::size_t cols, T* dst)
+{
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "Element size must be 1, 2, 4 or 8 bytes");
+    using U = typename detail::transpose_uint<sizeof(T)>::type;
+    detail::transpose_matrix_impl(reinterpret_cast<const U*>(src), rows, cols,
+                                  reinterpret_cast<U*>(dst));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_TRANSPOSE_H
@@ -0,0 +1,76 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_CLMUL_H
+#define LIBSIMDPP_SIMDPP_CORE_I_CLMUL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_clmul.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Performs carry-less multiplication of the lower 64-bit elements within
+    each 128-bit lane. The 128-bit products are stored to the corresponding
+    lanes of the result, lower half first.
+
+    @code
+    r0 = clmul(a0, b0) & 0xffffffffffffffff
+    r1 = clmul(a0, b0) >> 64
+    r2 = clmul(a2, b2) & 0xffffffffffffffff
+    r3 = clmul(a2, b2) >> 64
+    ...
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, MSA, 10-20}
+    @icost{NEON with PMULL, 2}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 20-40}
+    @icost{AVX2 with PCLMULQDQ, 4}
+*/
+template<unsigned N> SIMDPP_INL
+uint64<N> clmul_lo(const uint64<N>& a, const uint64<N>& b)
+{
+    return detail::insn::i_clmul_lo(a, b);
+}
+
+/** Performs carry-less multiplication of the upper 64-bit elements within
+    each 128-bit lane. The 128-bit products are stored to the corresponding
+    lanes of the result, lower half first.
+
+    @code
+    r0 = clmul(a1, b1) & 0xffffffffffffffff
+    r1 = clmul(a1, b1) >> 64
+    r2 = clmul(a3, b3) & 0xffffffffffffffff
+    r3 = clmul(a3, b3) >> 64
+    ...
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, MSA, 10-20}
+    @icost{NEON with PMULL, 2}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 20-40}
+    @icost{AVX2 with PCLMULQDQ, 4}
+*/
+template<unsigned N> SIMDPP_INL
+uint64<N> clmul_hi(const uint64<N>& a, const uint64<N>& b)
+{
+    return detail::insn::i_clmul_hi(a, b);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,30 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_FMA_H
+#define LIBSIMDPP_SIMDPP_DETAIL_FMA_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+
+/*  Defined to 1 if fmadd() and fmsub() are implemented for floating-point
+    vectors of all sizes on the current architecture, 0 otherwise. The product
+    is not rounded in these functions. The NULL implementation calls std::fma
+    for each element, thus it's exact but may be much slower than separate
+    multiplication and addition.
+*/
+#if SIMDPP_USE_NULL || SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || \
+    SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+#define SIMDPP_DETAIL_HAS_FMA 1
+#else
+#define SIMDPP_DETAIL_HAS_FMA 0
+#endif
+
+#endif
@@ -0,0 +1,155 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_CLMUL_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_CLMUL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/split.h>
+#include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+// PMULL is part of the optional crypto extension on AArch64
+#if SIMDPP_USE_NEON64 && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define SIMDPP_DETAIL_USE_NEON_PMULL 1
+#else
+#define SIMDPP_DETAIL_USE_NEON_PMULL 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+static SIMDPP_INL
+void el_clmul(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi)
+{
+    lo = 0;
+    hi = 0;
+    for (unsigned i = 0; i < 64; ++i) {
+        if ((b >> i) & 1) {
+            lo ^= a << i;
+            hi ^= i == 0 ? 0 : a >> (64 - i);
+        }
+    }
+}
+
+template<unsigned Sel> SIMDPP_INL
+uint64<2> v_emul_clmul(const uint64<2>& a, const uint64<2>& b)
+{
+    mem_block<uint64<2>> ma(a), mb(b), mr;
+    el_clmul(ma[Sel], mb[Sel], mr[0], mr[1]);
+    return mr;
+}
+
+static SIMDPP_INL
+uint64<2> i_clmul_lo(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_PCLMULQDQ
+    return _mm_clmulepi64_si128(a.native(), b.native(), 0x00);
+#elif SIMDPP_DETAIL_USE_NEON_PMULL
+    poly64x2_t pa = vreinterpretq_p64_u64(a.native());
+    poly64x2_t pb = vreinterpretq_p64_u64(b.native());
+    return vreinterpretq_u64_p128(vmull_p64(vgetq_lane_p64(pa, 0),
+                                            vgetq_lane_p64(pb, 0)));
+#else
+    return v_emul_clmul<0>(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint64<2> i_clmul_hi(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_PCLMULQDQ
+    return _mm_clmulepi64_si128(a.native(), b.native(), 0x11);
+#elif SIMDPP_DETAIL_USE_NEON_PMULL
+    return vreinterpretq_u64_p128(vmull_high_p64(vreinterpretq_p64_u64(a.native()),
+                                                 vreinterpretq_p64_u64(b.native())));
+#else
+    return v_emul_clmul<1>(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_clmul_lo(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_VPCLMULQDQ
+    return _mm256_clmulepi64_epi128(a.native(), b.native(), 0x00);
+#else
+    uint64<2> a0, a1, b0, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    return combine(i_clmul_lo(a0, b0), i_clmul_lo(a1, b1));
+#endif
+}
+
+static SIMDPP_INL
+uint64<4> i_clmul_hi(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_VPCLMULQDQ
+    return _mm256_clmulepi64_epi128(a.native(), b.native(), 0x11);
+#else
+    uint64<2> a0, a1, b0, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    return combine(i_clmul_hi(a0, b0), i_clmul_hi(a1, b1));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_clmul_lo(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_VPCLMULQDQ
+    return _mm512_clmulepi64_epi128(a.native(), b.native(), 0x00);
+#else
+    uint64<4> a0, a1, b0, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    return combine(i_clmul_lo(a0, b0), i_clmul_lo(a1, b1));
+#endif
+}
+
+static SIMDPP_INL
+uint64<8> i_clmul_hi(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_VPCLMULQDQ
+    return _mm512_clmulepi64_epi128(a.native(), b.native(), 0x11);
+#else
+    uint64<4> a0, a1, b0, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    return combine(i_clmul_hi(a0, b0), i_clmul_hi(a1, b1));
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_clmul_lo(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, uint64<N>, i_clmul_lo, a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_clmul_hi(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, uint64<N>, i_clmul_hi, a, b);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
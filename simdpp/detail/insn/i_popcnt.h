@@ -56,6 +56,8 @@ uint8<16> i_popcnt(const uint8<16>& a)
         r.el(i) = detail::null::el_popcnt8(a.el(i));
     }
     return r;
+#elif SIMDPP_USE_AVX512BITALG && SIMDPP_USE_AVX512VL
+    return _mm_popcnt_epi8(a.native());
 #elif SIMDPP_USE_NEON
     return vcntq_u8(a.native());
 #elif SIMDPP_USE_VSX_207
@@ -71,7 +73,11 @@ uint8<16> i_popcnt(const uint8<16>& a)
 static SIMDPP_INL
 uint8<32> i_popcnt(const uint8<32>& a)
 {
+#if SIMDPP_USE_AVX512BITALG && SIMDPP_USE_AVX512VL
+    return _mm256_popcnt_epi8(a.native());
+#else
     return v_emul_popcnt_u8(a);
+#endif
 }
 #endif
 
@@ -79,7 +85,11 @@ uint8<32> i_popcnt(const uint8<32>& a)
 static SIMDPP_INL
 uint8<64> i_popcnt(const uint8<64>& a)
 {
+#if SIMDPP_USE_AVX512BITALG
+    return _mm512_popcnt_epi8(a.native());
+#else
     return v_emul_popcnt_u8(a);
+#endif
 }
 #endif
 
@@ -112,6 +122,8 @@ uint16<8> i_popcnt(const uint16<8>& a)
         r.el(i) = detail::null::el_popcnt16(a.el(i));
     }
     return r;
+#elif SIMDPP_USE_AVX512BITALG && SIMDPP_USE_AVX512VL
+    return _mm_popcnt_epi16(a.native());
 #elif SIMDPP_USE_NEON
     uint8x16_t p8 = vcntq_u8(vreinterpretq_u8_u16(a.native()));
     return vpaddlq_u8(p8);
@@ -128,7 +140,11 @@ uint16<8> i_popcnt(const uint16<8>& a)
 static SIMDPP_INL
 uint16<16> i_popcnt(const uint16<16>& a)
 {
+#if SIMDPP_USE_AVX512BITALG && SIMDPP_USE_AVX512VL
+    return _mm256_popcnt_epi16(a.native());
+#else
     return v_emul_popcnt_u16(a);
+#endif
 }
 #endif
 
@@ -136,7 +152,11 @@ uint16<16> i_popcnt(const uint16<16>& a)
 static SIMDPP_INL
 uint16<32> i_popcnt(const uint16<32>& a)
 {
+#if SIMDPP_USE_AVX512BITALG
+    return _mm512_popcnt_epi16(a.native());
+#else
     return v_emul_popcnt_u16(a);
+#endif
 }
 #endif
 
@@ -175,6 +195,8 @@ uint32<4> i_popcnt(const uint32<4>& a)
         r.el(i) = detail::null::el_popcnt32(a.el(i));
     }
     return r;
+#elif SIMDPP_USE_AVX512VPOPCNTDQ && SIMDPP_USE_AVX512VL
+    return _mm_popcnt_epi32(a.native());
 #elif SIMDPP_USE_X86_POPCNT_INSN
     // slightly faster than the vectorized version
     unsigned a0 = _mm_popcnt_u32(extract<0>(a));
@@ -203,7 +225,11 @@ uint32<4> i_popcnt(const uint32<4>& a)
 static SIMDPP_INL
 uint32<8> i_popcnt(const uint32<8>& a)
 {
+#if SIMDPP_USE_AVX512VPOPCNTDQ && SIMDPP_USE_AVX512VL
+    return _mm256_popcnt_epi32(a.native());
+#else
     return v_emul_popcnt_u32(a);
+#endif
 }
 #endif
 
@@ -211,8 +237,11 @@ uint32<8> i_popcnt(const uint32<8>& a)
 static SIMDPP_INL
 uint32<16> i_popcnt(const uint32<16>& a)
 {
-    // TODO: support AVX512VPOPCNTDQ
+#if SIMDPP_USE_AVX512VPOPCNTDQ
+    return _mm512_popcnt_epi32(a.native());
+#else
     return v_emul_popcnt_u32(a);
+#endif
 }
 #endif
 
@@ -247,6 +276,8 @@ uint64<2> i_popcnt(const uint64<2>& a)
         r.el(i) = detail::null::el_popcnt64(a.el(i));
     }
     return r;
+#elif SIMDPP_USE_AVX512VPOPCNTDQ && SIMDPP_USE_AVX512VL
+    return _mm_popcnt_epi64(a.native());
 #elif SIMDPP_USE_X86_POPCNT_INSN
     unsigned a0, a1;
 #if SIMDPP_64_BITS
@@ -283,7 +314,9 @@ uint64<2> i_popcnt(const uint64<2>& a)
 static SIMDPP_INL
 uint64<4> i_popcnt(const uint64<4>& a)
 {
-#if SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
+#if SIMDPP_USE_AVX512VPOPCNTDQ && SIMDPP_USE_AVX512VL
+    return _mm256_popcnt_epi64(a.native());
+#elif SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
     uint64<2> a0, a1;
     split(a, a0, a1);
     a0 = i_popcnt(a0);
@@ -300,8 +333,9 @@ uint64<4> i_popcnt(const uint64<4>& a)
 static SIMDPP_INL
 uint64<8> i_popcnt(const uint64<8>& a)
 {
-    // TODO: support AVX512VPOPCNTDQ
-#if SIMDPP_USE_AVX512BW
+#if SIMDPP_USE_AVX512VPOPCNTDQ
+    return _mm512_popcnt_epi64(a.native());
+#elif SIMDPP_USE_AVX512BW
     uint8<64> p8 = v_emul_popcnt_u8((uint8<64>) a);
     return _mm512_sad_epu8(p8.native(), _mm512_setzero_si512());
 #else
@@ -138,7 +138,13 @@ SIMDPP_INL uint32_t i_reduce_mul(const uint16<N>& a)
         iprod = _mm512_mul_epu32(iprod.native(), move4_l<1>(iprod).native());
         prod = _mm512_mul_epu32(prod.native(), iprod.native());
     }
-    return reduce_mul(prod);
+    // only the even elements contain the products
+    uint32x8 r = _mm256_mul_epu32(extract256<0>(prod).native(),
+                                  extract256<1>(prod).native());
+    uint32x4 r2 = _mm_mul_epu32(detail::extract128<0>(r).native(),
+                                detail::extract128<1>(r).native());
+    r2 = _mm_mul_epu32(r2.native(), move4_l<2>(r2).native());
+    return extract<0>(r2);
 #elif SIMDPP_USE_AVX2
     uint32x8 prod = make_uint(1);
     for (unsigned j = 0; j < a.vec_length; ++j) {
@@ -303,7 +309,13 @@ SIMDPP_INL int32_t i_reduce_mul(const int16<N>& a)
         iprod = _mm512_mul_epu32(iprod.native(), move4_l<1>(iprod).native());
         prod = _mm512_mul_epu32(prod.native(), iprod.native());
     }
-    return reduce_mul(prod);
+    // only the even elements contain the products
+    uint32x8 r = _mm256_mul_epu32(extract256<0>(prod).native(),
+                                  extract256<1>(prod).native());
+    uint32x4 r2 = _mm_mul_epu32(detail::extract128<0>(r).native(),
+                                detail::extract128<1>(r).native());
+    r2 = _mm_mul_epu32(r2.native(), move4_l<2>(r2).native());
+    return extract<0>(r2);
 #elif SIMDPP_USE_AVX2
     uint32x8 prod = make_uint(1);
     for (unsigned j = 0; j < a.vec_length; ++j) {
@@ -423,6 +435,12 @@ SIMDPP_INL uint32_t i_reduce_mul(const uint32<N>& a)
         }
     }
     return r;
+#elif SIMDPP_USE_AVX512F
+    uint32<16> prod = make_uint(1);
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        prod = mul_lo(prod, a.vec(j));
+    }
+    return i_reduce_mul(prod);
 #elif SIMDPP_USE_AVX2
     uint32x8 prod = make_uint(1);
     for (unsigned j = 0; j < a.vec_length; ++j) {
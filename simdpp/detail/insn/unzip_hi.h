@@ -64,11 +64,21 @@ uint8x32 i_unzip16_hi(const uint8x32& ca, const uint8x32& cb)
 #if SIMDPP_USE_AVX512BW
 SIMDPP_INL uint8<64> i_unzip16_hi(const uint8<64>& ca, const uint8<64>& cb)
 {
+#if SIMDPP_USE_AVX512VBMI
+    // the even (odd) bytes of each 128-bit lane of both vectors are
+    // gathered with a single two-source byte permute
+    const __m512i idx = _mm512_set_epi32(0x7f7d7b79, 0x77757371, 0x3f3d3b39, 0x37353331,
+                                         0x6f6d6b69, 0x67656361, 0x2f2d2b29, 0x27252321,
+                                         0x5f5d5b59, 0x57555351, 0x1f1d1b19, 0x17151311,
+                                         0x4f4d4b49, 0x47454341, 0x0f0d0b09, 0x07050301);
+    return _mm512_permutex2var_epi8(ca.native(), idx, cb.native());
+#else
     uint8<64> a = ca, b = cb;
     a = _mm512_srai_epi16(a.native(), 8);
     b = _mm512_srai_epi16(b.native(), 8);
     a = _mm512_packs_epi16(a.native(), b.native());
     return a;
+#endif
 }
 #endif
 
@@ -72,6 +72,15 @@ uint8x32 i_unzip16_lo(const uint8x32& ca, const uint8x32& cb)
 #if SIMDPP_USE_AVX512BW
 SIMDPP_INL uint8<64> i_unzip16_lo(const uint8<64>& ca, const uint8<64>& cb)
 {
+#if SIMDPP_USE_AVX512VBMI
+    // the even (odd) bytes of each 128-bit lane of both vectors are
+    // gathered with a single two-source byte permute
+    const __m512i idx = _mm512_set_epi32(0x7e7c7a78, 0x76747270, 0x3e3c3a38, 0x36343230,
+                                         0x6e6c6a68, 0x66646260, 0x2e2c2a28, 0x26242220,
+                                         0x5e5c5a58, 0x56545250, 0x1e1c1a18, 0x16141210,
+                                         0x4e4c4a48, 0x46444240, 0x0e0c0a08, 0x06040200);
+    return _mm512_permutex2var_epi8(ca.native(), idx, cb.native());
+#else
     uint8<64> a = ca, b = cb;
     uint16<32> mask, r;
     mask = make_ones();
@@ -80,6 +89,7 @@ SIMDPP_INL uint8<64> i_unzip16_lo(const uint8<64>& ca, const uint8<64>& cb)
     b = bit_and(b, mask);
     r = _mm512_packus_epi16(a.native(), b.native());
     return uint8<64>(r);
+#endif
 }
 #endif
 
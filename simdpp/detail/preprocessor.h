@@ -12,12 +12,12 @@
 
 // Concatenates x1 and x2. The concatenation is performed before the arguments
 // are evaluated
-#define SIMDPP_PP_CAT22(x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22) \
-    x1 ## x2 ## x3 ## x4 ## x5 ## x6 ## x7 ## x8 ## x9 ## x10 ## x11 ## x12 ## x13 ## x14 ## x15 ## x16 ## x17 ## x18 ## x19 ## x20 ## x21 ## x22
+#define SIMDPP_PP_CAT36(x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36) \
+    x1 ## x2 ## x3 ## x4 ## x5 ## x6 ## x7 ## x8 ## x9 ## x10 ## x11 ## x12 ## x13 ## x14 ## x15 ## x16 ## x17 ## x18 ## x19 ## x20 ## x21 ## x22 ## x23 ## x24 ## x25 ## x26 ## x27 ## x28 ## x29 ## x30 ## x31 ## x32 ## x33 ## x34 ## x35 ## x36
 
 // Evaluates the arguments and concatenates the result
-#define SIMDPP_PP_PASTE22(x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22) \
-    SIMDPP_PP_CAT22(x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22)
+#define SIMDPP_PP_PASTE36(x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36) \
+    SIMDPP_PP_CAT36(x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36)
 
 #endif
 
@@ -16,11 +16,10 @@ namespace simdpp {
 
     Note: the exact values may change release to release.
 */
-/*  The values are assigned in such a way that the result of comparison of two
-    ORed flag sets is likely identify which instruction set the binary is more
-    likely to run faster on.
-
-    detail::select_version depends on this.
+/*  The values of the base instruction sets, each of which extends the
+    previous one, are assigned in increasing order. The values of the
+    auxiliary instruction sets are not ordered, thus the ORed flag sets must
+    be compared using detail::arch_is_better and not by value.
 */
 enum class Arch : std::uint32_t {
     /// Indicates that no SIMD instructions are supported
@@ -54,6 +53,39 @@ enum class Arch : std::uint32_t {
     X86_AVX512DQ = 1 << 13,
     /// Indicates x86 AVX-512VL suppotr
     X86_AVX512VL = 1 << 14,
+    /// Indicates x86 PCLMULQDQ (carry-less multiplication) support
+    X86_PCLMULQDQ = 1 << 15,
+    /// Indicates x86 VPCLMULQDQ (256 and 512-bit carry-less multiplication)
+    /// support
+    X86_VPCLMULQDQ = 1 << 16,
+    /// Indicates x86 BMI1 (bit manipulation instructions) support
+    X86_BMI1 = 1 << 17,
+    /// Indicates x86 BMI2 (pdep, pext and other bit manipulation
+    /// instructions) support
+    X86_BMI2 = 1 << 18,
+    /// Indicates x86 F16C (half-precision floating-point conversion) support
+    X86_F16C = 1 << 19,
+    /// Indicates x86 AVX-512VBMI (byte permutation) support
+    X86_AVX512VBMI = 1 << 20,
+    /// Indicates x86 AVX-512VBMI2 (byte and word compress, expand and
+    /// concatenated shifts) support
+    X86_AVX512VBMI2 = 1 << 21,
+    /// Indicates x86 AVX-512VNNI (integer dot product) support
+    X86_AVX512VNNI = 1 << 22,
+    /// Indicates x86 AVX-512BITALG (8 and 16-bit popcnt) support
+    X86_AVX512BITALG = 1 << 23,
+    /// Indicates x86 AVX-512VPOPCNTDQ (32 and 64-bit popcnt) support
+    X86_AVX512VPOPCNTDQ = 1 << 24,
+    /// Indicates x86 AVX-512BF16 (bfloat16 conversion and dot product)
+    /// support
+    X86_AVX512BF16 = 1 << 25,
+    /// Indicates x86 AVX-512FP16 (half-precision floating-point arithmetic)
+    /// support
+    X86_AVX512FP16 = 1 << 26,
+    /// Indicates x86 AVX-VNNI (VEX-encoded integer dot product) support
+    X86_AVXVNNI = 1 << 27,
+    /// Indicates x86 GFNI (Galois field arithmetic) support
+    X86_GFNI = 1 << 28,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
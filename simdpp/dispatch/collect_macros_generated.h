@@ -107,6 +107,76 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_1_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -138,7 +208,7 @@
     #define SIMDPP_DISPATCH_1_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_1_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE3,                                         \
@@ -151,6 +221,20 @@
         SIMDPP_DISPATCH_1_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_1_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_1_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_1_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_1_NS_ID_XOP,                                          \
@@ -265,6 +349,76 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_2_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -296,7 +450,7 @@
     #define SIMDPP_DISPATCH_2_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_2_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE3,                                         \
@@ -309,6 +463,20 @@
         SIMDPP_DISPATCH_2_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_2_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_2_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_2_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_2_NS_ID_XOP,                                          \
@@ -423,6 +591,76 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_3_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -454,7 +692,7 @@
     #define SIMDPP_DISPATCH_3_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_3_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE3,                                         \
@@ -467,6 +705,20 @@
         SIMDPP_DISPATCH_3_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_3_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_3_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_3_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_3_NS_ID_XOP,                                          \
@@ -581,6 +833,76 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_4_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -612,7 +934,7 @@
     #define SIMDPP_DISPATCH_4_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_4_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE3,                                         \
@@ -625,6 +947,20 @@
         SIMDPP_DISPATCH_4_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_4_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_4_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_4_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_4_NS_ID_XOP,                                          \
@@ -739,6 +1075,76 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_5_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -770,7 +1176,7 @@
     #define SIMDPP_DISPATCH_5_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_5_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE3,                                         \
@@ -783,6 +1189,20 @@
         SIMDPP_DISPATCH_5_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_5_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_5_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_5_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_5_NS_ID_XOP,                                          \
@@ -897,6 +1317,76 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_6_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -928,7 +1418,7 @@
     #define SIMDPP_DISPATCH_6_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_6_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE3,                                         \
@@ -941,6 +1431,20 @@
         SIMDPP_DISPATCH_6_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_6_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_6_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_6_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_6_NS_ID_XOP,                                          \
@@ -1055,6 +1559,76 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_7_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1086,7 +1660,7 @@
     #define SIMDPP_DISPATCH_7_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_7_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE3,                                         \
@@ -1099,6 +1673,20 @@
         SIMDPP_DISPATCH_7_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_7_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_7_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_7_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_7_NS_ID_XOP,                                          \
@@ -1213,6 +1801,76 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_8_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1244,7 +1902,7 @@
     #define SIMDPP_DISPATCH_8_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_8_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE3,                                         \
@@ -1257,6 +1915,20 @@
         SIMDPP_DISPATCH_8_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_8_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_8_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_8_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_8_NS_ID_XOP,                                          \
@@ -1371,6 +2043,76 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_9_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1402,7 +2144,7 @@
     #define SIMDPP_DISPATCH_9_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE36(arch,               \
         SIMDPP_DISPATCH_9_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE3,                                         \
@@ -1415,6 +2157,20 @@
         SIMDPP_DISPATCH_9_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_9_NS_ID_PCLMULQDQ,                                    \
+        SIMDPP_DISPATCH_9_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512BF16,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512FP16,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVXVNNI,                                      \
+        SIMDPP_DISPATCH_9_NS_ID_GFNI,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_9_NS_ID_XOP,                                          \
@@ -1529,6 +2285,76 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_10_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1560,7 +2386,7 @@
     #define SIMDPP_DISPATCH_10_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE36(arch,              \
         SIMDPP_DISPATCH_10_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE3,                                        \
@@ -1573,6 +2399,20 @@
         SIMDPP_DISPATCH_10_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_10_NS_ID_PCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_10_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512BF16,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512FP16,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVXVNNI,                                     \
+        SIMDPP_DISPATCH_10_NS_ID_GFNI,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_10_NS_ID_XOP,                                         \
@@ -1687,6 +2527,76 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_11_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1718,7 +2628,7 @@
     #define SIMDPP_DISPATCH_11_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE36(arch,              \
         SIMDPP_DISPATCH_11_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE3,                                        \
@@ -1731,6 +2641,20 @@
         SIMDPP_DISPATCH_11_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_11_NS_ID_PCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_11_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512BF16,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512FP16,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVXVNNI,                                     \
+        SIMDPP_DISPATCH_11_NS_ID_GFNI,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_11_NS_ID_XOP,                                         \
@@ -1845,6 +2769,76 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_12_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1876,7 +2870,7 @@
     #define SIMDPP_DISPATCH_12_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE36(arch,              \
         SIMDPP_DISPATCH_12_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE3,                                        \
@@ -1889,6 +2883,20 @@
         SIMDPP_DISPATCH_12_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_12_NS_ID_PCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_12_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512BF16,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512FP16,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVXVNNI,                                     \
+        SIMDPP_DISPATCH_12_NS_ID_GFNI,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_12_NS_ID_XOP,                                         \
@@ -2003,6 +3011,76 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_13_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2034,7 +3112,7 @@
     #define SIMDPP_DISPATCH_13_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE36(arch,              \
         SIMDPP_DISPATCH_13_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE3,                                        \
@@ -2047,6 +3125,20 @@
         SIMDPP_DISPATCH_13_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_13_NS_ID_PCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_13_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512BF16,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512FP16,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVXVNNI,                                     \
+        SIMDPP_DISPATCH_13_NS_ID_GFNI,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_13_NS_ID_XOP,                                         \
@@ -2161,6 +3253,76 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_14_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2192,7 +3354,7 @@
     #define SIMDPP_DISPATCH_14_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE36(arch,              \
         SIMDPP_DISPATCH_14_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE3,                                        \
@@ -2205,6 +3367,20 @@
         SIMDPP_DISPATCH_14_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_14_NS_ID_PCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_14_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512BF16,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512FP16,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVXVNNI,                                     \
+        SIMDPP_DISPATCH_14_NS_ID_GFNI,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_14_NS_ID_XOP,                                         \
@@ -2319,6 +3495,76 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_15_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2350,7 +3596,7 @@
     #define SIMDPP_DISPATCH_15_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE36(arch,              \
         SIMDPP_DISPATCH_15_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE3,                                        \
@@ -2363,6 +3609,20 @@
         SIMDPP_DISPATCH_15_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_15_NS_ID_PCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_15_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512BF16,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512FP16,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVXVNNI,                                     \
+        SIMDPP_DISPATCH_15_NS_ID_GFNI,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_15_NS_ID_XOP,                                         \
@@ -13,7 +13,11 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
+#include <ostream>
+#include <vector>
 #include <simdpp/dispatch/arch.h>
 
 namespace simdpp {
@@ -30,9 +34,27 @@ namespace simdpp {
     may redefine the macro and use different definitions for each site of
     @c SIMDPP_MAKE_DISPATCHER_* expansion.
 
-    The function identified by the @c SIMDPP_USER_ARCH_INFO is called at the
-    first time the specific dispatcher is invoked. The user must ensure that
-    proper synchronization is used if the dispatcher is called concurrently.
+    The expression identified by the @c SIMDPP_USER_ARCH_INFO is evaluated
+    once per process, when the first dispatcher is resolved. The result is
+    cached and used by all dispatchers, thus all dispatchers select versions
+    for the same architecture even if the macro is defined differently at
+    different sites. Concurrent first calls are synchronized: only one thread
+    evaluates the expression and the others wait for the result.
+
+    The detected architecture can be overridden at runtime using the
+    following environment variables. Each contains a list of architecture
+    names separated by commas or spaces as accepted by @c get_arch_env(),
+    e.g. "sse2,sse3" or "avx2,fma3,popcnt". A variable that contains an
+    unknown name is ignored.
+
+     - @c SIMDPP_FORCE_ARCH: replaces the detected architecture with exactly
+        the listed instruction sets. The variable is ignored if any of them is
+        not supported by the processor.
+
+     - @c SIMDPP_MAX_ARCH: limits the architecture to the listed instruction
+        sets. The instruction sets that are not listed are not used even if
+        they are supported, while the listed ones that are not supported are
+        ignored. Applied after @c SIMDPP_FORCE_ARCH.
 
     The user must ensure that the returned information is sensible: e.g. SSE2
     must be supported if SSE3 support is indicated.
@@ -41,6 +63,42 @@ namespace simdpp {
     implementations of CPU features detection.
 */
 
+/** @def SIMDPP_DISPATCH_STATS
+    If defined to 1 before including simd.h, each dispatcher created by
+    @c SIMDPP_MAKE_DISPATCHER and the related macros counts its calls. The
+    counts are kept separately for each version of the dispatched function and
+    are incremented using relaxed atomic operations. They are reported by
+    @c get_dispatcher_info() and @c dump_dispatch_stats().
+
+    The macro must have the same value in all translation units of the
+    program. The counting adds an atomic increment to each call, thus the mode
+    is intended for finding the hot dispatched functions and the instruction
+    sets they run on. The dispatchers are not implemented as GNU indirect
+    functions in this mode. The calls through the tables created by
+    @c SIMDPP_MAKE_DISPATCH_TABLE are not counted.
+*/
+#ifndef SIMDPP_DISPATCH_STATS
+#define SIMDPP_DISPATCH_STATS 0
+#endif
+
+/** Determines how a dispatcher selects among the versions supported by the
+    current processor.
+
+    @c BEST selects the version that needs the largest instruction set.
+
+    @c LIGHT is intended for kernels that run for a short time or are
+    interleaved with scalar code. On many processors, executing 512-bit
+    instructions reduces the clock frequency of the core for some time after
+    the instructions have finished, which slows down the surrounding code. For
+    such kernels the AVX-512 versions are skipped and the best version that
+    does not need any AVX-512 instruction set, e.g. the AVX2 one, is selected.
+    If there is no such version, the policy falls back to @c BEST.
+*/
+enum class DispatchPolicy {
+    BEST,
+    LIGHT
+};
+
 namespace detail {
 
 using VoidFunPtr = void (*)();
@@ -67,32 +125,340 @@ struct FnVersion {
     const char* arch_name;
 };
 
-inline FnVersion select_version_any(FnVersion* versions, unsigned size,
-                                    Arch arch)
+/*  Returns true if code compiled for @a lhs is expected to run faster than
+    code compiled for @a rhs. The values of the flags can't be compared
+    directly, because the flags of the auxiliary instruction sets such as
+    PCLMULQDQ or BMI2 are larger than the AVX-512 ones. Thus the base
+    instruction sets, each of which extends the previous one, are compared
+    first, then the number of the remaining flags and finally the values, so
+    that the order is total. The lowest flags of ARM, POWER and MIPS form
+    such chains too.
+*/
+inline bool arch_is_better(Arch lhs, Arch rhs)
 {
-    // No need to try to be very efficient here.
-    std::sort(versions, versions + size,
-              [](const FnVersion& lhs, const FnVersion& rhs) {
-                  return lhs.needed_arch > rhs.needed_arch;
-              });
+    using T = std::uint32_t;
+    const T base = T(1) | static_cast<T>(Arch::X86_SSE2 | Arch::X86_SSE3 |
+                                         Arch::X86_SSSE3 | Arch::X86_SSE4_1 |
+                                         Arch::X86_AVX | Arch::X86_AVX2 |
+                                         Arch::X86_AVX512F);
+    T l = static_cast<T>(lhs);
+    T r = static_cast<T>(rhs);
+    if ((l & base) != (r & base))
+        return (l & base) > (r & base);
+
+    // counted without builtins which may be implemented as library calls
+    unsigned l_count = 0, r_count = 0;
+    for (T la = l & ~base, ra = r & ~base; la != 0 || ra != 0; la >>= 1, ra >>= 1) {
+        l_count += la & 1;
+        r_count += ra & 1;
+    }
+    if (l_count != r_count)
+        return l_count > r_count;
+    return l > r;
+}
 
-    unsigned i;
-    for (i = 0; i < size; ++i) {
+/*  Returns the index of the supported version that is expected to be the
+    fastest, or size if no version is supported.
+*/
+inline unsigned select_version_index(const FnVersion* versions, unsigned size,
+                                     Arch arch)
+{
+    unsigned best = size;
+    for (unsigned i = 0; i < size; ++i) {
         if (versions[i].fun_ptr == nullptr)
             continue;
-        if (test_arch_subset(arch, versions[i].needed_arch)) {
-            break;
-        }
+        if (!test_arch_subset(arch, versions[i].needed_arch))
+            continue;
+        if (best == size || arch_is_better(versions[i].needed_arch,
+                                           versions[best].needed_arch))
+            best = i;
     }
-    if (i == size) {
+    return best;
+}
+
+/*  Returns the version to use according to the given policy. The versions are
+    scanned linearly without calling into other functions, so that the
+    function can also be used from ifunc resolvers.
+*/
+inline FnVersion select_version_any(FnVersion* versions, unsigned size,
+                                    Arch arch,
+                                    DispatchPolicy policy = DispatchPolicy::BEST)
+{
+    unsigned best = size;
+    if (policy == DispatchPolicy::LIGHT) {
+        // The bits are defined for x86 only; on other architectures the mask
+        // doesn't remove anything
+        Arch avx512 = Arch::X86_AVX512F | Arch::X86_AVX512BW |
+                      Arch::X86_AVX512DQ | Arch::X86_AVX512VL |
+                      Arch::X86_AVX512VBMI | Arch::X86_AVX512VBMI2 |
+                      Arch::X86_AVX512VNNI | Arch::X86_AVX512BITALG |
+                      Arch::X86_AVX512VPOPCNTDQ | Arch::X86_AVX512BF16 |
+                      Arch::X86_AVX512FP16;
+        best = select_version_index(versions, size, arch & ~avx512);
+    }
+    if (best == size)
+        best = select_version_index(versions, size, arch);
+    if (best == size) {
         // The user didn't provide the NONE_NULL version and no SIMD
         // architecture is supported. We can't do anything except to abort
         std::abort();
     }
-    return versions[i];
+    return versions[best];
+}
+
+/*  Receives the name and the available versions of a dispatcher. @a calls
+    contains the number of calls of each version if SIMDPP_DISPATCH_STATS is
+    enabled and is empty otherwise.
+*/
+struct DispatchQuery {
+    const char* name;
+    std::vector<FnVersion> versions;
+    std::vector<std::uint64_t> calls;
+};
+
+/*  A node of the process-wide list of dispatchers. Each dispatcher created by
+    SIMDPP_MAKE_DISPATCHER registers a node during static initialization so
+    that dispatch_init_all() can resolve it before the first call.
+
+    The resolve function selects the version of the dispatcher if @a query is
+    null. Otherwise it stores the information about the dispatcher to
+    @a query.
+*/
+struct DispatchResolveTag {};
+using DispatchResolveFunPtr = void (*)(DispatchResolveTag, DispatchQuery* query);
+
+struct DispatcherNode {
+    DispatchResolveFunPtr resolve;
+    const std::atomic<VoidFunPtr>* selected;
+    DispatcherNode* next;
+
+    DispatcherNode(DispatchResolveFunPtr r, const std::atomic<VoidFunPtr>* s);
+};
+
+inline std::atomic<DispatcherNode*>& get_dispatcher_list()
+{
+    static std::atomic<DispatcherNode*> head(nullptr);
+    return head;
+}
+
+inline DispatcherNode::DispatcherNode(DispatchResolveFunPtr r,
+                                      const std::atomic<VoidFunPtr>* s) :
+    resolve(r), selected(s), next(nullptr)
+{
+    std::atomic<DispatcherNode*>& head = get_dispatcher_list();
+    next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(next, this, std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+    }
 }
 
+// The maximum number of versions of a dispatcher for which the calls are
+// counted. Must not be less than SIMDPP_DISPATCH_MAX_ARCHS.
+static const unsigned dispatch_stats_max_versions = 16;
+
+/*  Holds the selected version of a dispatched function. Resolve is the
+    function that selects the version and uniquely identifies the
+    dispatcher. The pointer is published with release
+    semantics so that the dispatcher needs only a single acquire load on the
+    fast path. Concurrent resolution is benign, since all threads select the
+    same version.
+*/
+template<DispatchResolveFunPtr Resolve>
+struct DispatcherSlot {
+    static std::atomic<VoidFunPtr> selected;
+    static DispatcherNode node;
+#if SIMDPP_DISPATCH_STATS
+    // The index of the selected version within the versions collected by the
+    // resolver and the number of calls of each version
+    static std::atomic<unsigned> selected_index;
+    static std::atomic<std::uint64_t> calls[dispatch_stats_max_versions];
+#endif
+
+    // Publishes the selected version
+    static void select(const FnVersion* versions, unsigned size,
+                       const FnVersion& version)
+    {
+#if SIMDPP_DISPATCH_STATS
+        for (unsigned i = 0; i < size; ++i) {
+            if (versions[i].fun_ptr == version.fun_ptr) {
+                selected_index.store(i, std::memory_order_relaxed);
+                break;
+            }
+        }
+#else
+        (void) versions; (void) size;
+#endif
+        selected.store(version.fun_ptr, std::memory_order_release);
+    }
+
+    static void count_call()
+    {
+#if SIMDPP_DISPATCH_STATS
+        calls[selected_index.load(std::memory_order_relaxed)].fetch_add(
+                1, std::memory_order_relaxed);
+#endif
+    }
+
+    // Adds the versions and their call counts to @a query
+    static void query_versions(const FnVersion* versions, unsigned size,
+                               DispatchQuery* query)
+    {
+        for (unsigned i = 0; i < size; ++i) {
+            if (versions[i].fun_ptr == nullptr)
+                continue;
+            query->versions.push_back(versions[i]);
+#if SIMDPP_DISPATCH_STATS
+            query->calls.push_back(calls[i].load(std::memory_order_relaxed));
+#endif
+        }
+    }
+};
+
+template<DispatchResolveFunPtr Resolve>
+std::atomic<VoidFunPtr> DispatcherSlot<Resolve>::selected(nullptr);
+
+template<DispatchResolveFunPtr Resolve>
+DispatcherNode DispatcherSlot<Resolve>::node(Resolve, &DispatcherSlot<Resolve>::selected);
+
+#if SIMDPP_DISPATCH_STATS
+template<DispatchResolveFunPtr Resolve>
+std::atomic<unsigned> DispatcherSlot<Resolve>::selected_index(0);
+
+template<DispatchResolveFunPtr Resolve>
+std::atomic<std::uint64_t> DispatcherSlot<Resolve>::calls[dispatch_stats_max_versions] = {};
+#endif
+
 } // namespace detail
+
+/** Selects the versions of all dispatched functions created by
+    @c SIMDPP_MAKE_DISPATCHER that are linked into the program. Dispatchers of
+    function templates are included if the templates have been instantiated.
+    Calling this function at startup moves the architecture detection and the
+    version selection out of the first calls of the dispatched functions.
+
+    Calling the function is optional: the dispatchers that have not been
+    resolved select the version on the first call. The function is
+    thread-safe and may be called more than once.
+*/
+inline void dispatch_init_all()
+{
+    detail::DispatcherNode* node =
+            detail::get_dispatcher_list().load(std::memory_order_acquire);
+    for (; node != nullptr; node = node->next) {
+        node->resolve(detail::DispatchResolveTag(), nullptr);
+    }
+}
+
+/// Describes a version of a dispatched function
+struct DispatchVersionInfo {
+    /// The instruction sets that the version needs
+    Arch needed_arch;
+    /// The name of the architecture namespace of the version, e.g. "arch_sse2"
+    const char* arch_name;
+    /// The number of calls of the version. Always zero unless
+    /// @c SIMDPP_DISPATCH_STATS is enabled
+    std::uint64_t calls;
+};
+
+/// Describes a dispatcher created by @c SIMDPP_MAKE_DISPATCHER
+struct DispatcherInfo {
+    /// The name of the dispatched function
+    const char* name;
+    /// The versions of the function that are available, the best first
+    std::vector<DispatchVersionInfo> versions;
+    /// The index of the selected version in @a versions or -1 if the
+    /// dispatcher has not selected a version yet
+    int selected;
+};
+
+/** Returns the information about all dispatchers created by
+    @c SIMDPP_MAKE_DISPATCHER that are linked into the program, including the
+    available versions and the selected version of each. Dispatchers of
+    function templates are included if the templates have been instantiated.
+    Dispatchers implemented as indirect functions (see
+    @c SIMDPP_DISPATCH_USE_IFUNC) are not included.
+
+    Call @c dispatch_init_all() first to see the versions that would be
+    selected by all dispatchers.
+*/
+inline std::vector<DispatcherInfo> get_dispatcher_info()
+{
+    std::vector<DispatcherInfo> result;
+    detail::DispatcherNode* node =
+            detail::get_dispatcher_list().load(std::memory_order_acquire);
+    for (; node != nullptr; node = node->next) {
+        detail::DispatchQuery query;
+        query.name = "";
+        node->resolve(detail::DispatchResolveTag(), &query);
+        query.calls.resize(query.versions.size(), 0);
+
+        // the best version first
+        std::vector<std::size_t> order(query.versions.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(),
+                  [&](std::size_t lhs, std::size_t rhs) {
+                      return detail::arch_is_better(query.versions[lhs].needed_arch,
+                                                    query.versions[rhs].needed_arch);
+                  });
+
+        detail::VoidFunPtr selected = node->selected->load(std::memory_order_acquire);
+        DispatcherInfo info;
+        info.name = query.name;
+        info.selected = -1;
+        for (std::size_t i : order) {
+            const detail::FnVersion& version = query.versions[i];
+            if (version.fun_ptr == selected) {
+                info.selected = int(info.versions.size());
+            }
+            info.versions.push_back({version.needed_arch, version.arch_name,
+                                     query.calls[i]});
+        }
+        result.push_back(info);
+    }
+    return result;
+}
+
+/** Writes the call counts of all dispatchers that are linked into the
+    program to @a out, one line per version that has been called, e.g.:
+
+    @code
+    my_function arch_avx2_fma3_popcnt 1234 (selected)
+    @endcode
+
+    The dispatchers that haven't been called are omitted. Nothing except a
+    note is written unless @c SIMDPP_DISPATCH_STATS is enabled.
+*/
+inline void dump_dispatch_stats(std::ostream& out)
+{
+#if SIMDPP_DISPATCH_STATS
+    std::vector<DispatcherInfo> infos = get_dispatcher_info();
+    std::sort(infos.begin(), infos.end(),
+              [](const DispatcherInfo& lhs, const DispatcherInfo& rhs) {
+                  std::uint64_t lcalls = 0, rcalls = 0;
+                  for (const auto& v : lhs.versions) lcalls += v.calls;
+                  for (const auto& v : rhs.versions) rcalls += v.calls;
+                  return lcalls > rcalls;
+              });
+    for (const auto& info : infos) {
+        for (std::size_t i = 0; i < info.versions.size(); ++i) {
+            const DispatchVersionInfo& version = info.versions[i];
+            if (version.calls == 0)
+                continue;
+            out << info.name << ' '
+                << (version.arch_name != nullptr ? version.arch_name : "?") << ' '
+                << version.calls;
+            if (int(i) == info.selected)
+                out << " (selected)";
+            out << '\n';
+        }
+    }
+#else
+    out << "dispatch statistics are disabled; define SIMDPP_DISPATCH_STATS=1\n";
+#endif
+}
+
 } // namespace simdpp
 
 #endif
@@ -0,0 +1,127 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_GET_ARCH_ENV_H
+#define LIBSIMDPP_DISPATCH_GET_ARCH_ENV_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/get_arch_string_list.h>
+
+namespace simdpp {
+
+/** Retrieves architecture from the environment variable @a var. The variable
+    must contain a list of architecture names separated by commas or spaces.
+    The names are the same as accepted by @c get_arch_string_list(), e.g.
+    "sse2,sse3" or "avx2,fma3,popcnt". The name "null" denotes no instruction
+    sets. Returns false if the variable is not set or contains a name that
+    is not known on the current platform, in which case @a arch is not
+    modified.
+*/
+inline bool get_arch_env(const char* var, Arch& arch)
+{
+    const char* value = std::getenv(var);
+    if (value == nullptr) {
+        return false;
+    }
+    std::vector<std::string> names;
+    std::string name;
+    for (const char* p = value; ; ++p) {
+        if (*p == ',' || *p == ' ' || *p == '\0') {
+            if (!name.empty()) {
+                names.push_back(name);
+            }
+            name.clear();
+            if (*p == '\0') {
+                break;
+            }
+        } else {
+            name += *p;
+        }
+    }
+    Arch res = Arch::NONE_NULL;
+    for (const auto& n : names) {
+        if (n == "null") {
+            continue;
+        }
+        // a mistyped name must not silently disable instruction sets
+        const char* s = n.c_str();
+        Arch name_arch = get_arch_string_list(&s, 1, "");
+        if (name_arch == Arch::NONE_NULL) {
+            return false;
+        }
+        res |= name_arch;
+    }
+    arch = res;
+    return true;
+}
+
+namespace detail {
+
+/*  Applies SIMDPP_FORCE_ARCH and SIMDPP_MAX_ARCH to the detected architecture.
+    The forced architecture replaces the detected one only if the processor
+    supports all of it, so that the dispatchers never select instruction sets
+    that the processor does not support. The maximum architecture is
+    intersected with the result.
+*/
+inline Arch apply_dispatch_arch_env(Arch arch)
+{
+    Arch env;
+    if (get_arch_env("SIMDPP_FORCE_ARCH", env) && test_arch_subset(arch, env)) {
+        arch = env;
+    }
+    if (get_arch_env("SIMDPP_MAX_ARCH", env)) {
+        arch &= env;
+    }
+    return arch;
+}
+
+/*  The process-wide cache of the architecture returned by
+    SIMDPP_USER_ARCH_INFO. The state is 0 if the architecture has not been
+    detected yet, 1 if a thread is detecting it and 2 once it's available.
+*/
+struct DispatchArchCache {
+    std::atomic<unsigned> state;
+    std::atomic<std::uint32_t> arch;
+};
+
+inline DispatchArchCache& get_dispatch_arch_cache()
+{
+    // constant-initialized, thus safe to use during static initialization
+    static DispatchArchCache cache = { {0}, {0} };
+    return cache;
+}
+
+template<class F>
+Arch get_dispatch_arch(F detect)
+{
+    DispatchArchCache& cache = get_dispatch_arch_cache();
+    if (cache.state.load(std::memory_order_acquire) == 2) {
+        return static_cast<Arch>(cache.arch.load(std::memory_order_relaxed));
+    }
+    unsigned expected = 0;
+    if (cache.state.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+        Arch arch = apply_dispatch_arch_env(detect());
+        cache.arch.store(static_cast<std::uint32_t>(arch), std::memory_order_relaxed);
+        cache.state.store(2, std::memory_order_release);
+    } else {
+        while (cache.state.load(std::memory_order_acquire) != 2) {
+            std::this_thread::yield();
+        }
+    }
+    return static_cast<Arch>(cache.arch.load(std::memory_order_relaxed));
+}
+
+} // namespace detail
+} // namespace simdpp
+
+#endif
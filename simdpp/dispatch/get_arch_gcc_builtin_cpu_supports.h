@@ -63,6 +63,38 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
     }
     if (__builtin_cpu_supports("popcnt"))
         arch_info |= Arch::X86_POPCNT_INSN;
+#if (__GNUC__ >= 11) || (__clang_major__ >= 12)
+    if (__builtin_cpu_supports("pclmul"))
+        arch_info |= Arch::X86_PCLMULQDQ;
+    if (__builtin_cpu_supports("vpclmulqdq"))
+        arch_info |= Arch::X86_VPCLMULQDQ;
+    if (__builtin_cpu_supports("bmi"))
+        arch_info |= Arch::X86_BMI1;
+    if (__builtin_cpu_supports("bmi2"))
+        arch_info |= Arch::X86_BMI2;
+    if (__builtin_cpu_supports("avx512vbmi"))
+        arch_info |= Arch::X86_AVX512VBMI;
+    if (__builtin_cpu_supports("avx512vbmi2"))
+        arch_info |= Arch::X86_AVX512VBMI2;
+    if (__builtin_cpu_supports("avx512vnni"))
+        arch_info |= Arch::X86_AVX512VNNI;
+    if (__builtin_cpu_supports("avx512bitalg"))
+        arch_info |= Arch::X86_AVX512BITALG;
+    if (__builtin_cpu_supports("avx512vpopcntdq"))
+        arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+    if (__builtin_cpu_supports("avx512bf16"))
+        arch_info |= Arch::X86_AVX512BF16;
+    if (__builtin_cpu_supports("gfni"))
+        arch_info |= Arch::X86_GFNI;
+#endif
+#if (__GNUC__ >= 12) || (__clang_major__ >= 16)
+    if (__builtin_cpu_supports("f16c"))
+        arch_info |= Arch::X86_F16C;
+    if (__builtin_cpu_supports("avx512fp16"))
+        arch_info |= Arch::X86_AVX512FP16;
+    if (__builtin_cpu_supports("avxvnni"))
+        arch_info |= Arch::X86_AVXVNNI;
+#endif
 
     return arch_info;
 }
@@ -56,6 +56,20 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_pclmulqdq = a_sse2 | Arch::X86_PCLMULQDQ;
+    Arch a_vpclmulqdq = a_avx2 | a_pclmulqdq | Arch::X86_VPCLMULQDQ;
+    Arch a_bmi1 = a_sse2 | Arch::X86_BMI1;
+    Arch a_bmi2 = a_sse2 | Arch::X86_BMI2;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vbmi2 = a_avx512bw | Arch::X86_AVX512VBMI2;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512bitalg = a_avx512bw | Arch::X86_AVX512BITALG;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512bf16 = a_avx512bw | Arch::X86_AVX512BF16;
+    Arch a_avx512fp16 = a_avx512bw | Arch::X86_AVX512FP16;
+    Arch a_avxvnni = a_avx2 | Arch::X86_AVXVNNI;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
 
     ident = "flags\t";
     features["sse2"] = a_sse2;
@@ -72,6 +86,20 @@ inline Arch get_arch_linux_cpuinfo()
     features["avx512bw"] = a_avx512bw;
     features["avx512dq"] = a_avx512dq;
     features["avx512vl"] = a_avx512vl;
+    features["pclmulqdq"] = a_pclmulqdq;
+    features["vpclmulqdq"] = a_vpclmulqdq;
+    features["bmi1"] = a_bmi1;
+    features["bmi2"] = a_bmi2;
+    features["f16c"] = a_f16c;
+    features["avx512vbmi"] = a_avx512vbmi;
+    features["avx512_vbmi2"] = a_avx512vbmi2;
+    features["avx512_vnni"] = a_avx512vnni;
+    features["avx512_bitalg"] = a_avx512bitalg;
+    features["avx512_vpopcntdq"] = a_avx512vpopcntdq;
+    features["avx512_bf16"] = a_avx512bf16;
+    features["avx512_fp16"] = a_avx512fp16;
+    features["avx_vnni"] = a_avxvnni;
+    features["gfni"] = a_gfni;
 #else
     return res;
 #endif
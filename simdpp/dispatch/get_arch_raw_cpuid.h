@@ -126,6 +126,8 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_POPCNT_INSN;
         if (ecx & (1u << 12))
             arch_info |= Arch::X86_FMA3;
+        if (ecx & (1u << 1))
+            arch_info |= Arch::X86_PCLMULQDQ;
         if (ecx & (1u << 26)) {
             // XSAVE/XRSTORE available on hardware, now check OS support
             uint64_t xcr = simdpp::detail::get_xcr(0);
@@ -135,6 +137,8 @@ inline Arch get_arch_raw_cpuid()
 
         if (ecx & (1u << 28) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX;
+        if (ecx & (1u << 29) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_F16C;
     }
     if (max_ex_cpuid_level >= 0x80000001) {
         simdpp::detail::get_cpuid(0x80000001, 0, &eax, &ebx, &ecx, &edx);
@@ -146,6 +150,11 @@ inline Arch get_arch_raw_cpuid()
 
     if (max_cpuid_level >= 0x00000007) {
         simdpp::detail::get_cpuid(0x00000007, 0, &eax, &ebx, &ecx, &edx);
+        unsigned max_subleaf = eax;
+        if (ebx & (1u << 3))
+            arch_info |= Arch::X86_BMI1;
+        if (ebx & (1u << 8))
+            arch_info |= Arch::X86_BMI2;
         if (ebx & (1u << 5) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX2;
         if (ebx & (1u << 16) && xsave_xrstore_avail)
@@ -156,6 +165,30 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_AVX512DQ;
         if (ebx & (1u << 31) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX512VL;
+        if (ecx & (1u << 10) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_VPCLMULQDQ;
+        if (ecx & (1u << 8))
+            arch_info |= Arch::X86_GFNI;
+        if (ecx & (1u << 1) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VBMI;
+        if (ecx & (1u << 6) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VBMI2;
+        if (ecx & (1u << 11) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VNNI;
+        if (ecx & (1u << 12) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512BITALG;
+        if (ecx & (1u << 14) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+        if (edx & (1u << 23) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512FP16;
+
+        if (max_subleaf >= 1) {
+            simdpp::detail::get_cpuid(0x00000007, 1, &eax, &ebx, &ecx, &edx);
+            if (eax & (1u << 4) && xsave_xrstore_avail)
+                arch_info |= Arch::X86_AVXVNNI;
+            if (eax & (1u << 5) && xsave_xrstore_avail)
+                arch_info |= Arch::X86_AVX512BF16;
+        }
     }
 
     return arch_info;
@@ -55,6 +55,20 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_pclmulqdq = a_sse2 | Arch::X86_PCLMULQDQ;
+    Arch a_vpclmulqdq = a_avx2 | a_pclmulqdq | Arch::X86_VPCLMULQDQ;
+    Arch a_bmi1 = a_sse2 | Arch::X86_BMI1;
+    Arch a_bmi2 = a_sse2 | Arch::X86_BMI2;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vbmi2 = a_avx512bw | Arch::X86_AVX512VBMI2;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512bitalg = a_avx512bw | Arch::X86_AVX512BITALG;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512bf16 = a_avx512bw | Arch::X86_AVX512BF16;
+    Arch a_avx512fp16 = a_avx512bw | Arch::X86_AVX512FP16;
+    Arch a_avxvnni = a_avx2 | Arch::X86_AVXVNNI;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
 
     features.emplace_back("sse2", a_sse2);
     features.emplace_back("sse3", a_sse3);
@@ -70,6 +84,20 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     features.emplace_back("avx512bw", a_avx512bw);
     features.emplace_back("avx512dq", a_avx512dq);
     features.emplace_back("avx512vl", a_avx512vl);
+    features.emplace_back("pclmul", a_pclmulqdq);
+    features.emplace_back("vpclmul", a_vpclmulqdq);
+    features.emplace_back("bmi1", a_bmi1);
+    features.emplace_back("bmi2", a_bmi2);
+    features.emplace_back("f16c", a_f16c);
+    features.emplace_back("avx512vbmi", a_avx512vbmi);
+    features.emplace_back("avx512vbmi2", a_avx512vbmi2);
+    features.emplace_back("avx512vnni", a_avx512vnni);
+    features.emplace_back("avx512bitalg", a_avx512bitalg);
+    features.emplace_back("avx512vpopcntdq", a_avx512vpopcntdq);
+    features.emplace_back("avx512bf16", a_avx512bf16);
+    features.emplace_back("avx512fp16", a_avx512fp16);
+    features.emplace_back("avxvnni", a_avxvnni);
+    features.emplace_back("gfni", a_gfni);
 #elif SIMDPP_PPC
     Arch a_altivec = Arch::POWER_ALTIVEC;
     Arch a_vsx_206 = a_altivec | Arch::POWER_VSX_206;
@@ -0,0 +1,247 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_GET_CACHE_INFO_H
+#define LIBSIMDPP_DISPATCH_GET_CACHE_INFO_H
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <cstddef>
+#include <cstdint>
+
+#if __linux__
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#endif
+
+namespace simdpp {
+
+/** Describes the data cache hierarchy of the processor. The sizes are in
+    bytes. A member is zero if the corresponding value is not known or the
+    cache is not present.
+*/
+struct CacheInfo {
+    /// The size of the level 1 data cache of one core
+    std::size_t l1d_size;
+    /// The size of the level 2 cache
+    std::size_t l2_size;
+    /// The size of the level 3 cache
+    std::size_t l3_size;
+    /// The size of the cache line of the level 1 data cache
+    std::size_t line_size;
+};
+
+/*  The functions below are defined in the architecture namespace, because
+    they are used by the algorithms that are compiled once for each
+    architecture. Otherwise each of the multiversioned object files would
+    emit a copy of the inline functions compiled with its own instruction
+    set and the linker could select a copy that the processor doesn't
+    support for the whole program.
+*/
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+inline void set_cache_info_level(CacheInfo& info, unsigned level,
+                                 std::size_t size, std::size_t line_size)
+{
+    switch (level) {
+    case 1:
+        info.l1d_size = size;
+        if (line_size != 0) {
+            info.line_size = line_size;
+        }
+        break;
+    case 2: info.l2_size = size; break;
+    case 3: info.l3_size = size; break;
+    default: break;
+    }
+}
+
+// Fills the members of @a info that are zero from @a other
+inline void merge_cache_info(CacheInfo& info, const CacheInfo& other)
+{
+    if (info.l1d_size == 0) info.l1d_size = other.l1d_size;
+    if (info.l2_size == 0) info.l2_size = other.l2_size;
+    if (info.l3_size == 0) info.l3_size = other.l3_size;
+    if (info.line_size == 0) info.line_size = other.line_size;
+}
+
+} // namespace detail
+
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+#define SIMDPP_HAS_GET_CACHE_INFO_RAW_CPUID 1
+
+/** Retrieves the cache hierarchy using the CPUID instruction. The
+    deterministic cache parameters leaf 4 is used on Intel processors and
+    leaf 0x8000001D on AMD processors. The legacy leaves 0x80000005 and
+    0x80000006 are used on AMD processors that don't support the latter.
+    Works only on x86.
+*/
+inline CacheInfo get_cache_info_raw_cpuid()
+{
+    CacheInfo info = {};
+
+    uint32_t eax, ebx, ecx, edx;
+    ::simdpp::detail::get_cpuid(0, 0, &eax, &ebx, &ecx, &edx);
+    unsigned max_cpuid_level = eax;
+    ::simdpp::detail::cpu_manufacturer mfg =
+            ::simdpp::detail::get_cpu_manufacturer(ebx, ecx, edx);
+
+    ::simdpp::detail::get_cpuid(0x80000000, 0, &eax, &ebx, &ecx, &edx);
+    unsigned max_ex_cpuid_level = eax;
+
+    unsigned leaf = 0;
+    if (mfg == ::simdpp::detail::CPU_INTEL && max_cpuid_level >= 0x00000004) {
+        leaf = 0x00000004;
+    } else if (mfg == ::simdpp::detail::CPU_AMD &&
+               max_ex_cpuid_level >= 0x8000001D) {
+        ::simdpp::detail::get_cpuid(0x80000001, 0, &eax, &ebx, &ecx, &edx);
+        // topology extensions
+        if (ecx & (1u << 22))
+            leaf = 0x8000001D;
+    }
+
+    if (leaf != 0) {
+        // each subleaf describes one cache until the cache type is zero
+        for (unsigned i = 0; i < 16; ++i) {
+            ::simdpp::detail::get_cpuid(leaf, i, &eax, &ebx, &ecx, &edx);
+            unsigned type = eax & 0x1f;
+            if (type == 0)
+                break;
+            if (type == 2) // instruction cache
+                continue;
+            unsigned level = (eax >> 5) & 0x7;
+            std::size_t ways = ((ebx >> 22) & 0x3ff) + 1;
+            std::size_t partitions = ((ebx >> 12) & 0x3ff) + 1;
+            std::size_t line_size = (ebx & 0xfff) + 1;
+            std::size_t sets = std::size_t(ecx) + 1;
+            detail::set_cache_info_level(info, level,
+                    ways * partitions * line_size * sets, line_size);
+        }
+    } else if (mfg == ::simdpp::detail::CPU_AMD) {
+        if (max_ex_cpuid_level >= 0x80000005) {
+            ::simdpp::detail::get_cpuid(0x80000005, 0, &eax, &ebx, &ecx, &edx);
+            info.l1d_size = std::size_t((ecx >> 24) & 0xff) * 1024;
+            info.line_size = ecx & 0xff;
+        }
+        if (max_ex_cpuid_level >= 0x80000006) {
+            ::simdpp::detail::get_cpuid(0x80000006, 0, &eax, &ebx, &ecx, &edx);
+            info.l2_size = std::size_t((ecx >> 16) & 0xffff) * 1024;
+            info.l3_size = std::size_t((edx >> 18) & 0x3fff) * 512 * 1024;
+        }
+    }
+    return info;
+}
+#endif
+
+#if __linux__
+#define SIMDPP_HAS_GET_CACHE_INFO_LINUX_SYSFS 1
+
+namespace detail {
+
+// Reads the first word of the given file. Returns false on failure.
+inline bool read_sysfs_cache_value(const char* path, char* value, std::size_t size)
+{
+    std::FILE* f = std::fopen(path, "r");
+    if (f == nullptr) {
+        return false;
+    }
+    bool ok = std::fgets(value, int(size), f) != nullptr;
+    std::fclose(f);
+    if (!ok) {
+        return false;
+    }
+    value[std::strcspn(value, " \t\n")] = '\0';
+    return true;
+}
+
+// Parses sizes such as "48K" or "32M"
+inline std::size_t parse_sysfs_cache_size(const char* value)
+{
+    unsigned long size = 0;
+    char unit = 0;
+    if (std::sscanf(value, "%lu%c", &size, &unit) < 1) {
+        return 0;
+    }
+    switch (unit) {
+    case 'K': return std::size_t(size) * 1024;
+    case 'M': return std::size_t(size) * 1024 * 1024;
+    case 'G': return std::size_t(size) * 1024 * 1024 * 1024;
+    default: return std::size_t(size);
+    }
+}
+
+} // namespace detail
+
+/** Retrieves the cache hierarchy of the first processor from the Linux
+    /sys/devices/system/cpu/cpu0/cache directory. Works on all
+    architectures.
+*/
+inline CacheInfo get_cache_info_linux_sysfs()
+{
+    CacheInfo info = {};
+    const char* base = "/sys/devices/system/cpu/cpu0/cache/index";
+
+    for (unsigned i = 0; i < 16; ++i) {
+        char path[128];
+        char level[32], type[32], size[32], line_size[32];
+        std::snprintf(path, sizeof(path), "%s%u/level", base, i);
+        if (!detail::read_sysfs_cache_value(path, level, sizeof(level)))
+            break;
+        std::snprintf(path, sizeof(path), "%s%u/type", base, i);
+        if (!detail::read_sysfs_cache_value(path, type, sizeof(type)) ||
+            std::strcmp(type, "Instruction") == 0)
+            continue;
+        std::snprintf(path, sizeof(path), "%s%u/size", base, i);
+        if (!detail::read_sysfs_cache_value(path, size, sizeof(size)))
+            continue;
+        std::snprintf(path, sizeof(path), "%s%u/coherency_line_size", base, i);
+        if (!detail::read_sysfs_cache_value(path, line_size, sizeof(line_size)))
+            line_size[0] = '\0';
+        detail::set_cache_info_level(info, unsigned(std::atoi(level)),
+                                     detail::parse_sysfs_cache_size(size),
+                                     detail::parse_sysfs_cache_size(line_size));
+    }
+    return info;
+}
+#endif
+
+/** Returns the data cache hierarchy of the processor. CPUID is used on x86
+    and the Linux sysfs is used for the values that are still not known
+    afterwards. The result is computed once and cached.
+
+    The values are intended for choosing the blocking parameters of
+    algorithms at runtime, e.g. the tile sizes of a matrix multiplication.
+    The members are zero if the corresponding values can't be determined,
+    thus the caller must provide a fallback.
+*/
+inline CacheInfo get_cache_info()
+{
+    struct detector {
+        static CacheInfo detect()
+        {
+            CacheInfo info = {};
+#if SIMDPP_HAS_GET_CACHE_INFO_RAW_CPUID
+            info = get_cache_info_raw_cpuid();
+#endif
+#if SIMDPP_HAS_GET_CACHE_INFO_LINUX_SYSFS
+            if (info.l1d_size == 0 || info.l2_size == 0 || info.line_size == 0) {
+                detail::merge_cache_info(info, get_cache_info_linux_sysfs());
+            }
+#endif
+            return info;
+        }
+    };
+    static const CacheInfo info = detector::detect();
+    return info;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
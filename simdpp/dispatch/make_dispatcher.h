@@ -14,11 +14,20 @@
 #include <simdpp/detail/preprocessor/variadic/to_seq.hpp>
 
 #if SIMDPP_EMIT_DISPATCHER
+#include <simdpp/detail/preprocessor/punctuation/comma.hpp>
 #include <simdpp/detail/preprocessor/punctuation/comma_if.hpp>
 #include <simdpp/detail/preprocessor/seq/elem.hpp>
 #include <simdpp/detail/preprocessor/seq/for_each_i.hpp>
 #include <simdpp/detail/preprocessor/tuple/rem.hpp>
+#include <simdpp/detail/preprocessor/cat.hpp>
+#include <simdpp/detail/preprocessor/stringize.hpp>
 #include <simdpp/dispatch/collect_macros_generated.h>
+#include <simdpp/dispatch/get_arch_env.h>
+
+#if SIMDPP_DISPATCH_STATS
+static_assert(SIMDPP_DISPATCH_MAX_ARCHS <= ::simdpp::detail::dispatch_stats_max_versions,
+              "Increase dispatch_stats_max_versions in dispatcher.h");
+#endif
 
 // When debugging this code, it's a good idea to familiarize yourself with
 // advanced preprocessor techniques first. Several resources follow:
@@ -131,6 +140,33 @@
 #define SIMDPP_DETAIL_FORWARD(args)                                             \
     SIMDPP_PP_SEQ_FOR_EACH_I(SIMDPP_DETAIL_FORWARD_EACH, data, SIMDPP_PP_VARIADIC_TO_SEQ args)
 
+// The following 2 macros are the same as SIMDPP_DETAIL_TYPES and
+// SIMDPP_DETAIL_FORWARD except that each argument is preceded by a comma, e.g.
+// ', A, B, C'. An empty argument list expands to nothing. They are used to
+// append the arguments to an argument that precedes them.
+
+#define SIMDPP_DETAIL_COMMA_IF_ARG(T)                                           \
+    SIMDPP_PP_IIF(SIMDPP_PP_IS_BEGIN_PARENS(T),                                 \
+                  SIMDPP_PP_COMMA,                                              \
+                  SIMDPP_PP_EMPTY                                               \
+                 )()
+
+#define SIMDPP_DETAIL_COMMA_TYPES_EACH(r, data, x)                              \
+    SIMDPP_DETAIL_COMMA_IF_ARG(x) SIMDPP_DETAIL_EXTRACT_TYPE(x)
+
+#define SIMDPP_DETAIL_COMMA_FORWARD_EACH(r, data, x)                            \
+    SIMDPP_DETAIL_COMMA_IF_ARG(x) SIMDPP_DETAIL_EXTRACT_FORWARD(x)
+
+#define SIMDPP_DETAIL_COMMA_TYPES(args)                                         \
+    SIMDPP_PP_SEQ_FOR_EACH(SIMDPP_DETAIL_COMMA_TYPES_EACH, data, SIMDPP_PP_VARIADIC_TO_SEQ args)
+
+#define SIMDPP_DETAIL_COMMA_FORWARD(args)                                       \
+    SIMDPP_PP_SEQ_FOR_EACH(SIMDPP_DETAIL_COMMA_FORWARD_EACH, data, SIMDPP_PP_VARIADIC_TO_SEQ args)
+
+// Stringizes a token sequence that may contain commas
+#define SIMDPP_DETAIL_STRINGIZE_VA(...) SIMDPP_DETAIL_STRINGIZE_VA_I(__VA_ARGS__)
+#define SIMDPP_DETAIL_STRINGIZE_VA_I(...) #__VA_ARGS__
+
 // Will expand to 1 if argument contains SIMDPP_PP_PROBE macro anywhere, 0 otherwise
 #if ~SIMDPP_PP_CONFIG_FLAGS() & SIMDPP_PP_CONFIG_MSVC()
     #define SIMDPP_PP_PROBE_TO_BOOL(...)                                        \
@@ -258,29 +294,127 @@
 
 #define SIMDPP_DETAIL_RETURN_TOKEN() return
 
-#define SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(TEMPLATE_PREFIX, TEMPLATE_ARGS, R, NAME, ARGS) \
+// The dispatcher consists of two functions: the resolver, an overload of NAME
+// taking ::simdpp::detail::DispatchResolveTag, which selects the version and
+// publishes it in DispatcherSlot or describes the dispatcher, and the
+// dispatching function itself. The
+// resolver is referenced as a template argument of DispatcherSlot which
+// provides a unique slot for each dispatcher and registers it for
+// simdpp::dispatch_init_all().
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(POLICY, TEMPLATE_PREFIX, TEMPLATE_ARGS, R, NAME, ARGS) \
                                                                                 \
 SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
     (SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                   \
      SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
                                                                                 \
 SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
+void NAME(::simdpp::detail::DispatchResolveTag,                                 \
+          ::simdpp::detail::DispatchQuery* query)                               \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    using Slot = ::simdpp::detail::DispatcherSlot<                              \
+        &NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)>;                          \
+    ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};       \
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                                 \
+        (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)                  \
+    if (query != nullptr) {                                                     \
+        query->name = SIMDPP_PP_STRINGIZE(NAME);                                \
+        Slot::query_versions(versions, SIMDPP_DISPATCH_MAX_ARCHS, query);       \
+        return;                                                                 \
+    }                                                                           \
+    ::simdpp::detail::FnVersion version =                                       \
+        ::simdpp::detail::select_version_any(versions,                          \
+            SIMDPP_DISPATCH_MAX_ARCHS,                                          \
+            ::simdpp::detail::get_dispatch_arch(                                \
+                []() -> ::simdpp::Arch { return SIMDPP_USER_ARCH_INFO; }),      \
+            ::simdpp::DispatchPolicy::POLICY);                                  \
+    Slot::select(versions, SIMDPP_DISPATCH_MAX_ARCHS, version);                 \
+}                                                                               \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
 SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
 {                                                                               \
     using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
-    static FunPtr selected = nullptr;                                           \
+    using Slot = ::simdpp::detail::DispatcherSlot<                              \
+        &NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)>;                          \
+    (void) &Slot::node; /* instantiates the registration */                     \
+    ::simdpp::detail::VoidFunPtr selected =                                     \
+        Slot::selected.load(std::memory_order_acquire);                         \
     if (selected == nullptr) {                                                  \
-        ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
-        SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                             \
-            (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)              \
-        ::simdpp::detail::FnVersion version =                                   \
-            ::simdpp::detail::select_version_any(versions,                      \
-                SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO);              \
-        selected = reinterpret_cast<FunPtr>(version.fun_ptr);                   \
+        NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)(                            \
+            ::simdpp::detail::DispatchResolveTag(), nullptr);                   \
+        selected = Slot::selected.load(std::memory_order_acquire);              \
     }                                                                           \
-    SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) selected(SIMDPP_DETAIL_FORWARD(ARGS));  \
+    Slot::count_call();                                                         \
+    SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R)                                         \
+        reinterpret_cast<FunPtr>(selected)(SIMDPP_DETAIL_FORWARD(ARGS));        \
 }
 
+/** @def SIMDPP_DISPATCH_USE_IFUNC
+    If defined to 1 before including simd.h, the dispatchers of non-template
+    functions created by @c SIMDPP_MAKE_DISPATCHER are implemented as GNU
+    indirect functions. The dynamic loader calls the resolver once when the
+    program or library is loaded and binds the dispatched function directly to
+    the selected version, so that calls are equivalent to calls through the
+    PLT and don't check whether the version has been selected.
+
+    The resolver runs before the static constructors and, in shared libraries,
+    possibly before the relocations of the library are processed. Thus it
+    detects the architecture with @c get_arch_raw_cpuid() and ignores
+    @c SIMDPP_USER_ARCH_INFO and the @c SIMDPP_FORCE_ARCH and
+    @c SIMDPP_MAX_ARCH environment variables. The mode is available on x86
+    ELF platforms with GCC and Clang; elsewhere, and for dispatchers of
+    function templates, the regular dispatcher is used.
+*/
+#if SIMDPP_DISPATCH_USE_IFUNC && !SIMDPP_DISPATCH_STATS && \
+    defined(__ELF__) && (__GNUC__ || __clang__)
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+#define SIMDPP_DETAIL_DISPATCH_IFUNC 1
+#endif
+#endif
+
+#if SIMDPP_DETAIL_DISPATCH_IFUNC
+// The resolver is a static function with an assembler name that is unique
+// within the translation unit so that it can be referred to by the ifunc
+// attribute.
+#define SIMDPP_DETAIL_MAKE_IFUNC_DISPATCHER_IMPL(POLICY, R, NAME, ARGS, ID)     \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
+                                                                                \
+static SIMDPP_PP_REMOVE_PARENS(R)(*SIMDPP_PP_CAT(simdpp_ifunc_resolve_, ID)())  \
+    (SIMDPP_DETAIL_TYPES(ARGS))                                                 \
+    __asm__(SIMDPP_PP_STRINGIZE(SIMDPP_PP_CAT(simdpp_ifunc_resolve_, ID)));     \
+                                                                                \
+static SIMDPP_PP_REMOVE_PARENS(R)(*SIMDPP_PP_CAT(simdpp_ifunc_resolve_, ID)())  \
+    (SIMDPP_DETAIL_TYPES(ARGS))                                                 \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};       \
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, (NAME), FunPtr)                 \
+    ::simdpp::detail::FnVersion version =                                       \
+        ::simdpp::detail::select_version_any(versions,                          \
+            SIMDPP_DISPATCH_MAX_ARCHS, ::simdpp::get_arch_raw_cpuid(),          \
+            ::simdpp::DispatchPolicy::POLICY);                                  \
+    return reinterpret_cast<FunPtr>(version.fun_ptr);                           \
+}                                                                               \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_TYPES(ARGS))                      \
+    __attribute__((ifunc(                                                       \
+        SIMDPP_PP_STRINGIZE(SIMDPP_PP_CAT(simdpp_ifunc_resolve_, ID)))));
+
+// Expands __COUNTER__ once so that the same identifier is used throughout
+#define SIMDPP_DETAIL_MAKE_IFUNC_DISPATCHER_I(POLICY, R, NAME, ARGS, ID)        \
+    SIMDPP_DETAIL_MAKE_IFUNC_DISPATCHER_IMPL(POLICY, R, NAME, ARGS, ID)
+
+#define SIMDPP_DETAIL_MAKE_NONTEMPLATE_DISPATCHER_IMPL(POLICY, R, NAME, ARGS)   \
+    SIMDPP_DETAIL_MAKE_IFUNC_DISPATCHER_I(POLICY, R, NAME, ARGS, __COUNTER__)
+#else
+#define SIMDPP_DETAIL_MAKE_NONTEMPLATE_DISPATCHER_IMPL(POLICY, R, NAME, ARGS)   \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(POLICY, (), (), R, NAME, ARGS)
+#endif
+
 #define SIMDPP_DETAIL_IGNORE_PARENS2(x)                                         \
     SIMDPP_DETAIL_IGNORE_PARENS(SIMDPP_DETAIL_IGNORE_PARENS(x))
 
@@ -296,19 +430,17 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
 
 // SIMDPP_PP_SEQ_ELEM does not work with sequence elements containing commas,
 // so we use a workaround
-#define SIMDPP_DETAIL_MAKE_DISPATCHER1(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
-#define SIMDPP_DETAIL_MAKE_DISPATCHER2(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
-#define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC)                                    \
-    SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(                                         \
-        (),                                                                     \
-        (),                                                                     \
+#define SIMDPP_DETAIL_MAKE_DISPATCHER1(POLICY, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER2(POLICY, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER3(POLICY, DESC)                                    \
+    SIMDPP_DETAIL_MAKE_NONTEMPLATE_DISPATCHER_IMPL(POLICY,                      \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
         SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
 
-#define SIMDPP_DETAIL_MAKE_DISPATCHER4(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
-#define SIMDPP_DETAIL_MAKE_DISPATCHER5(DESC)                                    \
-    SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(                                         \
+#define SIMDPP_DETAIL_MAKE_DISPATCHER4(POLICY, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER5(POLICY, DESC)                                    \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(POLICY,                                  \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC))), \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))), \
@@ -316,8 +448,110 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS4(DESC))))
 
 
-#define SIMDPP_DETAIL_MAKE_DISPATCHER6(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
-#define SIMDPP_DETAIL_MAKE_DISPATCHER7(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER6(POLICY, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER7(POLICY, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+
+// The dispatcher of a member function forwards to the versions of a
+// non-member function that take the object as the first argument. The
+// resolver is a static member of a helper class with a unique name in an
+// anonymous namespace. The helper can't be a function in the enclosing
+// namespace, because the name of the member function would hide it within
+// the body of the member function. The helper is a template if the member
+// function is, thus each instantiation has its own slot.
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_IMPL(POLICY, CV, TEMPLATE_PREFIX, TEMPLATE_ARGS, \
+                                                  CLASS, R, NAME, ARGS, ID)     \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                   \
+     SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_PP_REMOVE_PARENS(CV)               \
+        SIMDPP_PP_REMOVE_PARENS(CLASS)& SIMDPP_DETAIL_COMMA_TYPES(ARGS))))      \
+                                                                                \
+namespace {                                                                     \
+SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
+struct SIMDPP_PP_CAT(simdpp_member_dispatcher_, ID) {                           \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_PP_REMOVE_PARENS(CV)    \
+        SIMDPP_PP_REMOVE_PARENS(CLASS)& SIMDPP_DETAIL_COMMA_TYPES(ARGS));       \
+                                                                                \
+    static void resolve(::simdpp::detail::DispatchResolveTag,                   \
+                        ::simdpp::detail::DispatchQuery* query)                 \
+    {                                                                           \
+        using Slot = ::simdpp::detail::DispatcherSlot<                          \
+            &SIMDPP_PP_CAT(simdpp_member_dispatcher_, ID)                       \
+                SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)::resolve>;               \
+        ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
+        SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                             \
+            (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)              \
+        if (query != nullptr) {                                                 \
+            query->name = SIMDPP_DETAIL_STRINGIZE_VA(                           \
+                SIMDPP_PP_REMOVE_PARENS(CLASS)::NAME);                          \
+            Slot::query_versions(versions, SIMDPP_DISPATCH_MAX_ARCHS, query);   \
+            return;                                                             \
+        }                                                                       \
+        ::simdpp::detail::FnVersion version =                                   \
+            ::simdpp::detail::select_version_any(versions,                      \
+                SIMDPP_DISPATCH_MAX_ARCHS,                                      \
+                ::simdpp::detail::get_dispatch_arch(                            \
+                    []() -> ::simdpp::Arch { return SIMDPP_USER_ARCH_INFO; }),  \
+                ::simdpp::DispatchPolicy::POLICY);                              \
+        Slot::select(versions, SIMDPP_DISPATCH_MAX_ARCHS, version);             \
+    }                                                                           \
+};                                                                              \
+} /* namespace */                                                               \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)                                        \
+SIMDPP_PP_REMOVE_PARENS(R) SIMDPP_PP_REMOVE_PARENS(CLASS)::NAME(                \
+        SIMDPP_DETAIL_ARGS(ARGS)) SIMDPP_PP_REMOVE_PARENS(CV)                   \
+{                                                                               \
+    using Dispatcher = SIMDPP_PP_CAT(simdpp_member_dispatcher_, ID)             \
+        SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS);                                 \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_PP_REMOVE_PARENS(CV)    \
+        SIMDPP_PP_REMOVE_PARENS(CLASS)& SIMDPP_DETAIL_COMMA_TYPES(ARGS));       \
+    using Slot = ::simdpp::detail::DispatcherSlot<&Dispatcher::resolve>;        \
+    (void) &Slot::node; /* instantiates the registration */                     \
+    ::simdpp::detail::VoidFunPtr selected =                                     \
+        Slot::selected.load(std::memory_order_acquire);                         \
+    if (selected == nullptr) {                                                  \
+        Dispatcher::resolve(::simdpp::detail::DispatchResolveTag(), nullptr);   \
+        selected = Slot::selected.load(std::memory_order_acquire);              \
+    }                                                                           \
+    Slot::count_call();                                                         \
+    SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R)                                         \
+        reinterpret_cast<FunPtr>(selected)(*this                                \
+                                           SIMDPP_DETAIL_COMMA_FORWARD(ARGS));  \
+}
+
+// Expands __COUNTER__ once so that the same identifier is used throughout
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_I(POLICY, CV, TEMPLATE_PREFIX, TEMPLATE_ARGS, \
+                                               CLASS, R, NAME, ARGS, ID)        \
+    SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_IMPL(POLICY, CV, TEMPLATE_PREFIX,      \
+                                              TEMPLATE_ARGS, CLASS, R, NAME, ARGS, ID)
+
+#define SIMDPP_DETAIL_IGNORE_PARENS5(x)                                         \
+    SIMDPP_DETAIL_IGNORE_PARENS(SIMDPP_DETAIL_IGNORE_PARENS4(x))
+
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER1(POLICY, CV, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER2(POLICY, CV, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER3(POLICY, CV, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER4(POLICY, CV, DESC)                 \
+    SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_I(POLICY, CV, (), (),                  \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC))), \
+        SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC)), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS3(DESC))), \
+        __COUNTER__)
+
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER5(POLICY, CV, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER6(POLICY, CV, DESC)                 \
+    SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_I(POLICY, CV,                          \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC))), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS3(DESC))), \
+        SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS4(DESC)), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS5(DESC))), \
+        __COUNTER__)
+
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER7(POLICY, CV, DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 
 /** Builds a dispatcher for a specific non-member function. The same macro is
     used for functions with or without return value, with different parameter
@@ -362,19 +596,161 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
     implements the dispatch mechanism.
 
     The dispatch functions check the enabled instruction set and select the
-    best function on first call. The initialization does not introduce race
-    conditions when done concurrently.
+    best function on first call, or when @c simdpp::dispatch_init_all() is
+    called. The selected function is published atomically, thus concurrent
+    first calls don't introduce data races. Once the function has been
+    selected, each call costs a single load and an indirect call.
+
+    The macro additionally defines an overload of the function that takes a
+    @c simdpp::detail::DispatchResolveTag argument. It is used internally to
+    select the version and by @c simdpp::get_dispatcher_info().
 
     The generated dispatching code links to all versions of the dispatched
     function statically, so techniques to prevent linkers from stripping
     unreferenced object files are not needed.
 */
 #define SIMDPP_MAKE_DISPATCHER(DESC)                                            \
-    SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_DISPATCHER, SIMDPP_PP_SEQ_SIZE(DESC))(DESC)
+    SIMDPP_MAKE_DISPATCHER_POLICY(BEST, DESC)
+
+/** Same as @c SIMDPP_MAKE_DISPATCHER, except that the version is selected
+    according to @a POLICY, the name of an enumerator of
+    @c simdpp::DispatchPolicy. For example:
+
+    SIMDPP_MAKE_DISPATCHER_POLICY(LIGHT, (void)(my_function1)((int) x))
+
+    selects the AVX2 version of @c my_function1 over the AVX-512 version even
+    if the processor supports AVX-512. The policy is also used by the
+    resolvers of the GNU indirect functions.
+*/
+#define SIMDPP_MAKE_DISPATCHER_POLICY(POLICY, DESC)                             \
+    SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_DISPATCHER, SIMDPP_PP_SEQ_SIZE(DESC))(POLICY, DESC)
+
+/** Builds a dispatcher for a specific member function. The member function
+    must be declared in the class. The macro defines it outside the class and
+    the definition dispatches to versions of a non-member function with the
+    same name that take a reference to the object as the first argument.
+
+    The macro accepts a sequence of 4 or 6 parenthesized token groups. Each
+    group conveys the following information:
+     - (optional) the full template prefix of the member function, e.g.
+        (template<class T>). If the class is a class template, the prefix
+        declares its template parameters instead.
+     - (optional) the template argument list enclosed in brackets, e.g. (<T>)
+     - the class, e.g. (my_class) or (my_class<T>)
+     - the return type, e.g. (void), or (float)
+     - the function name, e.g. (my_function)
+     - comma separated list of function arguments in the same format as for
+        @c SIMDPP_MAKE_DISPATCHER.
+
+    For example:
+
+    @code
+    struct my_class {
+        void process(float* p, std::size_t n);
+        template<class T> T sum(const T* p, std::size_t n);
+        float scale;
+    };
+
+    namespace SIMDPP_ARCH_NAMESPACE {
+    void process(my_class& self, float* p, std::size_t n) { ... }
+    template<class T> T sum(my_class& self, const T* p, std::size_t n) { ... }
+    }
+
+    SIMDPP_MAKE_MEMBER_DISPATCHER((my_class)(void)(process)
+                                  ((float*) p, (std::size_t) n))
+    SIMDPP_MAKE_MEMBER_DISPATCHER((template<class T>)(<T>)(my_class)(T)(sum)
+                                  ((const T*) p, (std::size_t) n))
+    SIMDPP_INSTANTIATE_MEMBER_DISPATCHER(
+        ((template float my_class::sum<float>(const float*, std::size_t))),
+        ((template float sum<float>(my_class&, const float*, std::size_t))))
+    @endcode
+
+    The versions of the non-member function are only able to access the
+    public members of the class, unless the class befriends them.
+
+    The macro must be used in the same places as @c SIMDPP_MAKE_DISPATCHER.
+    The version is selected the same way: on first call, or when
+    @c simdpp::dispatch_init_all() is called. Each instantiation of a member
+    function template has its own selected version. The instantiations must
+    be defined by @c SIMDPP_INSTANTIATE_MEMBER_DISPATCHER. The dispatchers of member
+    functions are never implemented as GNU indirect functions.
+*/
+#define SIMDPP_MAKE_MEMBER_DISPATCHER(DESC)                                     \
+    SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER,                         \
+                  SIMDPP_PP_SEQ_SIZE(DESC))(BEST, (), DESC)
+
+/** Same as @c SIMDPP_MAKE_MEMBER_DISPATCHER, except that the member function
+    is const and the versions of the non-member function take a const
+    reference to the object as the first argument.
+*/
+#define SIMDPP_MAKE_CONST_MEMBER_DISPATCHER(DESC)                               \
+    SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER,                         \
+                  SIMDPP_PP_SEQ_SIZE(DESC))(BEST, (const), DESC)
 #else // #if SIMDPP_EMIT_DISPATCHER
 #define SIMDPP_MAKE_DISPATCHER(DESC)
+#define SIMDPP_MAKE_DISPATCHER_POLICY(POLICY, DESC)
+#define SIMDPP_MAKE_MEMBER_DISPATCHER(DESC)
+#define SIMDPP_MAKE_CONST_MEMBER_DISPATCHER(DESC)
 #endif
 
+#define SIMDPP_DETAIL_DISPATCH_TABLE_EACH(r, data, x) data.x = &x;
+
+/** Builds a dispatched table of functions. The table allows to select the
+    versions of a group of functions for the same architecture in one step.
+    The caller then loads the table once and calls the functions through it,
+    e.g. in a loop, without going through a dispatcher for each call.
+
+    The macro accepts the following parameters:
+     - TYPE: the type of the table. It must be a default-constructible struct
+        containing a function pointer member for each function. The members
+        that are not listed are value-initialized.
+     - NAME: the name of the function that returns a pointer to the table.
+     - MEMBERS: a sequence of parenthesized names of the functions, e.g.
+        (fun1)(fun2)(fun3). Each member of @a TYPE with the given name is set
+        to the address of SIMDPP_ARCH_NAMESPACE::name. If the function is
+        overloaded, the type of the member selects the overload.
+
+    The macro defines the function const TYPE* NAME() in
+    SIMDPP_ARCH_NAMESPACE and a dispatcher for it in the namespace the macro is
+    used in. The latter must be declared by the user. The macro must be used in
+    the same places as @c SIMDPP_MAKE_DISPATCHER. For example:
+
+    @code
+    struct my_kernels {
+        void (*scale)(float* p, std::size_t n, float a);
+        float (*sum)(const float* p, std::size_t n);
+    };
+    const my_kernels* get_my_kernels();
+
+    namespace SIMDPP_ARCH_NAMESPACE {
+    void scale(float* p, std::size_t n, float a) { ... }
+    float sum(const float* p, std::size_t n) { ... }
+    }
+
+    SIMDPP_MAKE_DISPATCH_TABLE(my_kernels, get_my_kernels, (scale)(sum))
+
+    // ...
+    const my_kernels* k = get_my_kernels();
+    for (...) {
+        k->scale(p, n, 2.0f);
+        s += k->sum(p, n);
+    }
+    @endcode
+*/
+#define SIMDPP_MAKE_DISPATCH_TABLE(TYPE, NAME, MEMBERS)                         \
+namespace SIMDPP_ARCH_NAMESPACE {                                               \
+    const TYPE* NAME()                                                          \
+    {                                                                           \
+        static const TYPE table = []() {                                        \
+            TYPE t = TYPE();                                                    \
+            SIMDPP_PP_SEQ_FOR_EACH(SIMDPP_DETAIL_DISPATCH_TABLE_EACH, t, MEMBERS) \
+            return t;                                                           \
+        }();                                                                    \
+        return &table;                                                          \
+    }                                                                           \
+}                                                                               \
+SIMDPP_MAKE_DISPATCHER((const TYPE*)(NAME)())
+
 #define SIMDPP_DETAIL_SIGNATURE_EACH(r, data, x) SIMDPP_PP_REMOVE_PARENS(x) ;
 #define SIMDPP_DETAIL_SIGNATURES(signatures)                                    \
     SIMDPP_PP_SEQ_FOR_EACH(SIMDPP_DETAIL_SIGNATURE_EACH, data,                  \
@@ -407,11 +783,38 @@ SIMDPP_DETAIL_SIGNATURES((__VA_ARGS__))
 namespace SIMDPP_ARCH_NAMESPACE {                                               \
     SIMDPP_DETAIL_SIGNATURES((__VA_ARGS__))                                     \
 }
+
+/** Defines one or more template instantiations for a dispatcher of a member
+    function template. The first argument is a parenthesized list of full
+    instantiations of the member function and the second argument is a
+    parenthesized list of the corresponding instantiations of the non-member
+    versions. For example:
+
+    SIMDPP_INSTANTIATE_MEMBER_DISPATCHER(
+        ((template float my_class::sum<float>(const float*, std::size_t)),
+         (template double my_class::sum<double>(const double*, std::size_t))),
+        ((template float sum<float>(my_class&, const float*, std::size_t)),
+         (template double sum<double>(my_class&, const double*, std::size_t)))
+    )
+
+    The instantiations of the member function are emitted only in the object
+    file that contains the dispatcher and the instantiations of the versions
+    in all multiversioned object files.
+*/
+#define SIMDPP_INSTANTIATE_MEMBER_DISPATCHER(MEMBERS, VERSIONS)                 \
+SIMDPP_DETAIL_SIGNATURES(MEMBERS)                                               \
+namespace SIMDPP_ARCH_NAMESPACE {                                               \
+    SIMDPP_DETAIL_SIGNATURES(VERSIONS)                                          \
+}
 #else // SIMDPP_EMIT_DISPATCHER
 #define SIMDPP_INSTANTIATE_DISPATCHER(...)                                      \
 namespace SIMDPP_ARCH_NAMESPACE {                                               \
     SIMDPP_DETAIL_SIGNATURES((__VA_ARGS__))                                     \
 }
+#define SIMDPP_INSTANTIATE_MEMBER_DISPATCHER(MEMBERS, VERSIONS)                 \
+namespace SIMDPP_ARCH_NAMESPACE {                                               \
+    SIMDPP_DETAIL_SIGNATURES(VERSIONS)                                          \
+}
 #endif
 
 #endif // LIBSIMDPP_DISPATCH_MAKE_DISPATCHER_H
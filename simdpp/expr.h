@@ -9,6 +9,17 @@
 #define LIBSIMDPP_SIMD_EXPR_H
 
 #include <simdpp/setup_arch.h>
+#include <simdpp/detail/fma.h>
+
+/*  Set SIMDPP_EXPR_FUSE_FMA to 1 before including simd.h to evaluate the
+    a * b + c, a * b - c, c + a * b and c - a * b expressions of floating-point
+    vectors using fused multiply-add instructions. The results differ from
+    those of separate multiplication and addition because the product is not
+    rounded. Has effect only on architectures that implement fmadd().
+*/
+#ifndef SIMDPP_EXPR_FUSE_FMA
+#define SIMDPP_EXPR_FUSE_FMA 0
+#endif
 
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
@@ -63,6 +74,52 @@ struct expr_vec_load_u : expr_vec_construct<expr_vec_load_u> {
     expr_vec_load_u(const char* x) : a(x) {}
 };
 
+/*  The result of multiplication of floating-point vectors when
+    SIMDPP_EXPR_FUSE_FMA is enabled. Only the operands are stored, so that an
+    addition or subtraction of the product can be evaluated as a single fused
+    operation. The expression is not a vector and can't be modified through a
+    reference to a vector, thus it never holds a product that is out of date
+    with the operands. It converts to V, which evaluates the product; call
+    eval() or convert explicitly to pass the product to the functions that
+    accept vectors.
+*/
+template<class V>
+struct expr_fmul {
+    V a, b;
+
+    SIMDPP_INL expr_fmul(const V& x, const V& y) : a(x), b(y) {}
+
+    // The product of the vector and ones is exact, thus the assigned value is
+    // not changed by fusing it into a subsequent addition or subtraction
+    SIMDPP_INL expr_fmul& operator=(const V& v)
+    {
+        expr_vec_make_const<double,1> one;
+        one.a[0] = 1.0;
+        a = v; b = one; return *this;
+    }
+
+    SIMDPP_INL operator V() const { return eval(); }
+    SIMDPP_INL V eval() const { return mul(a, b); }
+};
+
+namespace detail {
+
+/*  Defines type R if S is one of the scalar types that are accepted by the
+    operators in place of a vector (see SIMDPP_SCALAR_ARG_IMPL_VEC). Used to
+    restrict the operators of expr_fmul that take a scalar argument.
+*/
+template<class S, class R> struct expr_fmul_scalar {};
+template<class R> struct expr_fmul_scalar<unsigned, R> { using type = R; };
+template<class R> struct expr_fmul_scalar<unsigned long, R> { using type = R; };
+template<class R> struct expr_fmul_scalar<unsigned long long, R> { using type = R; };
+template<class R> struct expr_fmul_scalar<int, R> { using type = R; };
+template<class R> struct expr_fmul_scalar<long, R> { using type = R; };
+template<class R> struct expr_fmul_scalar<long long, R> { using type = R; };
+template<class R> struct expr_fmul_scalar<float, R> { using type = R; };
+template<class R> struct expr_fmul_scalar<double, R> { using type = R; };
+
+} // namespace detail
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
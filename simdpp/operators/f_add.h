@@ -15,6 +15,8 @@
 
 #include <simdpp/types.h>
 #include <simdpp/core/f_add.h>
+#include <simdpp/core/f_fmadd.h>
+#include <simdpp/core/make_float.h>
 #include <simdpp/core/detail/scalar_arg_impl.h>
 
 namespace simdpp {
@@ -63,6 +65,49 @@ float64<N> operator+(const float64<N>& a, const float64<N>& b)
 
 SIMDPP_SCALAR_ARG_IMPL_VEC(operator+, float64, float64)
 
+#if SIMDPP_EXPR_FUSE_FMA && SIMDPP_DETAIL_HAS_FMA
+/** Adds a vector to a product of two vectors using a fused multiply-add
+    operation. Used when SIMDPP_EXPR_FUSE_FMA is enabled.
+
+    @code
+    r0 = a0 * b0 + c0
+    ...
+    rN = aN * bN + cN
+    @endcode
+*/
+template<class V> SIMDPP_INL
+V operator+(const expr_fmul<V>& ab, const V& c)
+{
+    return fmadd(ab.a, ab.b, c);
+}
+
+template<class V> SIMDPP_INL
+V operator+(const V& c, const expr_fmul<V>& ab)
+{
+    return fmadd(ab.a, ab.b, c);
+}
+
+template<class V> SIMDPP_INL
+V operator+(const expr_fmul<V>& ab, const expr_fmul<V>& c)
+{
+    return fmadd(ab.a, ab.b, c.eval());
+}
+
+template<class V, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, V>::type
+    operator+(const expr_fmul<V>& ab, const S& c)
+{
+    return fmadd(ab.a, ab.b, make_float<V>(c));
+}
+
+template<class V, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, V>::type
+    operator+(const S& c, const expr_fmul<V>& ab)
+{
+    return fmadd(ab.a, ab.b, make_float<V>(c));
+}
+#endif
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -32,6 +32,28 @@ namespace SIMDPP_ARCH_NAMESPACE {
     @par 256-bit version:
     @icost{SSE2-SSE4.1, NEON, ALTIVEC, 2}
 */
+#if SIMDPP_EXPR_FUSE_FMA && SIMDPP_DETAIL_HAS_FMA
+template<unsigned N> SIMDPP_INL
+expr_fmul<float32<N>> operator*(const float32<N>& a, const float32<N>& b)
+{
+    return expr_fmul<float32<N>>(a, b);
+}
+
+// The products with scalars are fused too
+template<unsigned N, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, expr_fmul<float32<N>>>::type
+    operator*(const S& a, const float32<N>& b)
+{
+    return make_float<float32<N>>(a) * b;
+}
+
+template<unsigned N, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, expr_fmul<float32<N>>>::type
+    operator*(const float32<N>& a, const S& b)
+{
+    return a * make_float<float32<N>>(b);
+}
+#else
 template<unsigned N> SIMDPP_INL
 float32<N> operator*(const float32<N>& a, const float32<N>& b)
 {
@@ -39,6 +61,7 @@ float32<N> operator*(const float32<N>& a, const float32<N>& b)
 }
 
 SIMDPP_SCALAR_ARG_IMPL_VEC(operator*, float32, float32)
+#endif
 
 /** Multiplies the values of two vectors
 
@@ -55,6 +78,28 @@ SIMDPP_SCALAR_ARG_IMPL_VEC(operator*, float32, float32)
     @novec{NEON, ALTIVEC}
     @icost{SSE2-SSE4.1, 2}
 */
+#if SIMDPP_EXPR_FUSE_FMA && SIMDPP_DETAIL_HAS_FMA
+template<unsigned N> SIMDPP_INL
+expr_fmul<float64<N>> operator*(const float64<N>& a, const float64<N>& b)
+{
+    return expr_fmul<float64<N>>(a, b);
+}
+
+// The products with scalars are fused too
+template<unsigned N, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, expr_fmul<float64<N>>>::type
+    operator*(const S& a, const float64<N>& b)
+{
+    return make_float<float64<N>>(a) * b;
+}
+
+template<unsigned N, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, expr_fmul<float64<N>>>::type
+    operator*(const float64<N>& a, const S& b)
+{
+    return a * make_float<float64<N>>(b);
+}
+#else
 template<unsigned N> SIMDPP_INL
 float64<N> operator*(const float64<N>& a, const float64<N>& b)
 {
@@ -62,6 +107,51 @@ float64<N> operator*(const float64<N>& a, const float64<N>& b)
 }
 
 SIMDPP_SCALAR_ARG_IMPL_VEC(operator*, float64, float64)
+#endif
+
+#if SIMDPP_EXPR_FUSE_FMA && SIMDPP_DETAIL_HAS_FMA
+/** Multiplies a product of two vectors by a vector. The result is a product
+    too, thus it can be fused into a subsequent addition or subtraction. Used
+    when SIMDPP_EXPR_FUSE_FMA is enabled.
+
+    @code
+    r0 = a0 * b0 * c0
+    ...
+    rN = aN * bN * cN
+    @endcode
+*/
+template<class V> SIMDPP_INL
+expr_fmul<V> operator*(const expr_fmul<V>& ab, const V& c)
+{
+    return expr_fmul<V>(ab.eval(), c);
+}
+
+template<class V> SIMDPP_INL
+expr_fmul<V> operator*(const V& c, const expr_fmul<V>& ab)
+{
+    return expr_fmul<V>(c, ab.eval());
+}
+
+template<class V> SIMDPP_INL
+expr_fmul<V> operator*(const expr_fmul<V>& ab, const expr_fmul<V>& c)
+{
+    return expr_fmul<V>(ab.eval(), c.eval());
+}
+
+template<class V, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, expr_fmul<V>>::type
+    operator*(const expr_fmul<V>& ab, const S& c)
+{
+    return expr_fmul<V>(ab.eval(), make_float<V>(c));
+}
+
+template<class V, class S> SIMDPP_INL
+typename detail::expr_fmul_scalar<S, expr_fmul<V>>::type
+    operator*(const S& c, const expr_fmul<V>& ab)
+{
+    return expr_fmul<V>(make_float<V>(c), ab.eval());
+}
+#endif
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
@@ -91,6 +91,76 @@
 #else
 #define SIMDPP_USE_AVX512VL 0
 #endif
+#if SIMDPP_ARCH_PP_USE_PCLMULQDQ
+#define SIMDPP_USE_PCLMULQDQ 1
+#else
+#define SIMDPP_USE_PCLMULQDQ 0
+#endif
+#if SIMDPP_ARCH_PP_USE_VPCLMULQDQ
+#define SIMDPP_USE_VPCLMULQDQ 1
+#else
+#define SIMDPP_USE_VPCLMULQDQ 0
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI1
+#define SIMDPP_USE_BMI1 1
+#else
+#define SIMDPP_USE_BMI1 0
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+#define SIMDPP_USE_BMI2 1
+#else
+#define SIMDPP_USE_BMI2 0
+#endif
+#if SIMDPP_ARCH_PP_USE_F16C
+#define SIMDPP_USE_F16C 1
+#else
+#define SIMDPP_USE_F16C 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+#define SIMDPP_USE_AVX512VBMI 1
+#else
+#define SIMDPP_USE_AVX512VBMI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#define SIMDPP_USE_AVX512VBMI2 1
+#else
+#define SIMDPP_USE_AVX512VBMI2 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_USE_AVX512VNNI 1
+#else
+#define SIMDPP_USE_AVX512VNNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+#define SIMDPP_USE_AVX512BITALG 1
+#else
+#define SIMDPP_USE_AVX512BITALG 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#define SIMDPP_USE_AVX512VPOPCNTDQ 1
+#else
+#define SIMDPP_USE_AVX512VPOPCNTDQ 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BF16
+#define SIMDPP_USE_AVX512BF16 1
+#else
+#define SIMDPP_USE_AVX512BF16 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512FP16
+#define SIMDPP_USE_AVX512FP16 1
+#else
+#define SIMDPP_USE_AVX512FP16 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVXVNNI
+#define SIMDPP_USE_AVXVNNI 1
+#else
+#define SIMDPP_USE_AVXVNNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+#define SIMDPP_USE_GFNI 1
+#else
+#define SIMDPP_USE_GFNI 0
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
 #define SIMDPP_USE_NEON 1
 #else
@@ -199,6 +269,76 @@
 #else
 #define SIMDPP_NS_ID_AVX512VL
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+#define SIMDPP_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+#else
+#define SIMDPP_NS_ID_PCLMULQDQ
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+#define SIMDPP_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+#else
+#define SIMDPP_NS_ID_VPCLMULQDQ
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_BMI1
+#define SIMDPP_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+#else
+#define SIMDPP_NS_ID_BMI1
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_BMI2
+#define SIMDPP_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+#else
+#define SIMDPP_NS_ID_BMI2
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_F16C
+#define SIMDPP_NS_ID_F16C SIMDPP_INSN_ID_F16C
+#else
+#define SIMDPP_NS_ID_F16C
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#define SIMDPP_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+#else
+#define SIMDPP_NS_ID_AVX512VBMI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+#define SIMDPP_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+#else
+#define SIMDPP_NS_ID_AVX512VBMI2
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#define SIMDPP_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+#else
+#define SIMDPP_NS_ID_AVX512VNNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+#define SIMDPP_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+#else
+#define SIMDPP_NS_ID_AVX512BITALG
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+#else
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+#define SIMDPP_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+#else
+#define SIMDPP_NS_ID_AVX512BF16
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+#define SIMDPP_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+#else
+#define SIMDPP_NS_ID_AVX512FP16
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+#define SIMDPP_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+#else
+#define SIMDPP_NS_ID_AVXVNNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_GFNI
+#define SIMDPP_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+#else
+#define SIMDPP_NS_ID_GFNI
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_NEON
 #define SIMDPP_NS_ID_NEON SIMDPP_INSN_ID_NEON
 #else
@@ -230,7 +370,7 @@
 #define SIMDPP_NS_ID_MSA
 #endif
 
-#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE22(arch,                           \
+#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE36(arch,                           \
     SIMDPP_NS_ID_NULL,                                                          \
     SIMDPP_NS_ID_SSE2,                                                          \
     SIMDPP_NS_ID_SSE3,                                                          \
@@ -243,6 +383,20 @@
     SIMDPP_NS_ID_AVX512BW,                                                      \
     SIMDPP_NS_ID_AVX512DQ,                                                      \
     SIMDPP_NS_ID_AVX512VL,                                                      \
+    SIMDPP_NS_ID_PCLMULQDQ,                                                     \
+    SIMDPP_NS_ID_VPCLMULQDQ,                                                    \
+    SIMDPP_NS_ID_BMI1,                                                          \
+    SIMDPP_NS_ID_BMI2,                                                          \
+    SIMDPP_NS_ID_F16C,                                                          \
+    SIMDPP_NS_ID_AVX512VBMI,                                                    \
+    SIMDPP_NS_ID_AVX512VBMI2,                                                   \
+    SIMDPP_NS_ID_AVX512VNNI,                                                    \
+    SIMDPP_NS_ID_AVX512BITALG,                                                  \
+    SIMDPP_NS_ID_AVX512VPOPCNTDQ,                                               \
+    SIMDPP_NS_ID_AVX512BF16,                                                    \
+    SIMDPP_NS_ID_AVX512FP16,                                                    \
+    SIMDPP_NS_ID_AVXVNNI,                                                       \
+    SIMDPP_NS_ID_GFNI,                                                          \
     SIMDPP_NS_ID_FMA3,                                                          \
     SIMDPP_NS_ID_FMA4,                                                          \
     SIMDPP_NS_ID_XOP,                                                           \
@@ -314,6 +468,19 @@
     #include <immintrin.h>
 #endif
 
+#if SIMDPP_USE_PCLMULQDQ
+    #include <wmmintrin.h>
+#endif
+
+#if SIMDPP_USE_VPCLMULQDQ
+    #include <immintrin.h>
+#endif
+
+#if SIMDPP_USE_BMI1 || SIMDPP_USE_BMI2 || SIMDPP_USE_F16C || SIMDPP_USE_GFNI || \
+    SIMDPP_USE_AVXVNNI
+    #include <immintrin.h>
+#endif
+
 #if SIMDPP_USE_NEON || SIMDPP_USE_NEON_FLT_SP
     #include <arm_neon.h>
 #endif
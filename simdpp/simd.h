@@ -70,6 +70,7 @@
 #include <simdpp/core/i_avg.h>
 #include <simdpp/core/i_avg_trunc.h>
 #include <simdpp/core/i_clamp.h>
+#include <simdpp/core/i_clmul.h>
 #include <simdpp/core/i_div_p.h>
 #include <simdpp/core/i_max.h>
 #include <simdpp/core/i_min.h>
@@ -66,6 +66,48 @@ inline Arch this_compile_arch()
 #if SIMDPP_USE_AVX512VL
     res |= Arch::X86_AVX512VL;
 #endif
+#if SIMDPP_USE_PCLMULQDQ
+    res |= Arch::X86_PCLMULQDQ;
+#endif
+#if SIMDPP_USE_VPCLMULQDQ
+    res |= Arch::X86_VPCLMULQDQ;
+#endif
+#if SIMDPP_USE_BMI1
+    res |= Arch::X86_BMI1;
+#endif
+#if SIMDPP_USE_BMI2
+    res |= Arch::X86_BMI2;
+#endif
+#if SIMDPP_USE_F16C
+    res |= Arch::X86_F16C;
+#endif
+#if SIMDPP_USE_AVX512VBMI
+    res |= Arch::X86_AVX512VBMI;
+#endif
+#if SIMDPP_USE_AVX512VBMI2
+    res |= Arch::X86_AVX512VBMI2;
+#endif
+#if SIMDPP_USE_AVX512VNNI
+    res |= Arch::X86_AVX512VNNI;
+#endif
+#if SIMDPP_USE_AVX512BITALG
+    res |= Arch::X86_AVX512BITALG;
+#endif
+#if SIMDPP_USE_AVX512VPOPCNTDQ
+    res |= Arch::X86_AVX512VPOPCNTDQ;
+#endif
+#if SIMDPP_USE_AVX512BF16
+    res |= Arch::X86_AVX512BF16;
+#endif
+#if SIMDPP_USE_AVX512FP16
+    res |= Arch::X86_AVX512FP16;
+#endif
+#if SIMDPP_USE_AVXVNNI
+    res |= Arch::X86_AVXVNNI;
+#endif
+#if SIMDPP_USE_GFNI
+    res |= Arch::X86_GFNI;
+#endif
 #if SIMDPP_USE_NEON
     res |= Arch::ARM_NEON;
 #endif
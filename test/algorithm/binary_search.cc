@@ -0,0 +1,70 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/binary_search.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T, class Dist>
+void test_lower_bound_batch_type(TestReporter& tr, Dist dist)
+{
+    std::minstd_rand rng(99);
+
+    // sizes around powers of two and with duplicate elements
+    const unsigned sizes[] = { 0, 1, 2, 3, 7, 8, 9, 31, 64, 100, 257, 1000 };
+    for (unsigned n : sizes) {
+        std::vector<T> sorted(n);
+        for (auto& x : sorted) {
+            x = dist(rng);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        // queries both from the array and random ones
+        const unsigned nq = 77;
+        std::vector<T> queries(nq);
+        for (unsigned i = 0; i < nq; ++i) {
+            queries[i] = (n != 0 && i % 3 == 0) ? sorted[i % n] : dist(rng);
+        }
+
+        std::vector<uint32_t> expected(nq), out(nq), out_ey(nq);
+        for (unsigned i = 0; i < nq; ++i) {
+            expected[i] = uint32_t(std::lower_bound(sorted.begin(), sorted.end(),
+                                                    queries[i]) - sorted.begin());
+        }
+
+        simdpp::lower_bound_batch(sorted.data(), n, queries.data(), nq, out.data());
+        TEST_EQUAL_MEMORY(tr, out.data(), expected.data(), nq);
+
+        simdpp::eytzinger_index<T> index(sorted.data(), n);
+        TEST_EQUAL(tr, index.size(), std::size_t(n));
+        index.lower_bound_batch(queries.data(), nq, out_ey.data());
+        TEST_EQUAL_MEMORY(tr, out_ey.data(), expected.data(), nq);
+        for (unsigned i = 0; i < nq; i += 5) {
+            TEST_EQUAL(tr, index.lower_bound(queries[i]), expected[i]);
+        }
+    }
+}
+
+void test_algorithm_binary_search(TestReporter& tr)
+{
+    test_lower_bound_batch_type<uint32_t>(tr,
+        std::uniform_int_distribution<uint32_t>(0, 500));
+    test_lower_bound_batch_type<uint32_t>(tr,
+        std::uniform_int_distribution<uint32_t>(0xfffff000u, 0xffffffffu));
+    test_lower_bound_batch_type<int32_t>(tr,
+        std::uniform_int_distribution<int32_t>(-300, 300));
+    test_lower_bound_batch_type<float>(tr,
+        std::uniform_real_distribution<float>(-100.0f, 100.0f));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,86 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/blocked_bloom.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void test_blocked_bloom_single_key(TestReporter& tr)
+{
+    simdpp::blocked_bloom filter(1);
+    TEST_EQUAL(tr, filter.num_blocks(), std::size_t(1));
+    TEST_EQUAL(tr, filter.size_bytes(), std::size_t(32));
+    TEST_EQUAL(tr, filter.contains(1234), false);
+
+    // each key sets exactly one bit in each 32-bit word of the block
+    filter.insert(1234);
+    TEST_EQUAL(tr, filter.contains(1234), true);
+    for (unsigned i = 0; i < 8; ++i) {
+        uint32_t w = filter.data()[i];
+        TEST_EQUAL(tr, w != 0 && (w & (w - 1)) == 0, true);
+    }
+
+    filter.clear();
+    TEST_EQUAL(tr, filter.contains(1234), false);
+}
+
+void test_blocked_bloom_batch(TestReporter& tr)
+{
+    std::minstd_rand rng(7);
+    std::uniform_int_distribution<uint64_t> dist;
+
+    const unsigned num_keys = 1000;
+    std::vector<uint64_t> keys(num_keys), others(num_keys);
+    for (unsigned i = 0; i < num_keys; ++i) {
+        keys[i] = dist(rng);
+        others[i] = dist(rng);
+    }
+
+    // approximately 16 bits per key
+    simdpp::blocked_bloom batch_filter(num_keys * 2);
+    simdpp::blocked_bloom scalar_filter(num_keys * 2);
+    TEST_EQUAL(tr, batch_filter.num_blocks(), std::size_t(63));
+
+    batch_filter.insert_batch(keys.data(), num_keys);
+    for (unsigned i = 0; i < num_keys; ++i) {
+        scalar_filter.insert(keys[i]);
+    }
+    TEST_EQUAL_MEMORY(tr, batch_filter.data(), scalar_filter.data(),
+                      batch_filter.num_blocks() * 8);
+
+    // no false negatives
+    std::unique_ptr<bool[]> found(new bool[num_keys]);
+    batch_filter.contains_batch(keys.data(), num_keys, found.get());
+    unsigned num_found = 0;
+    for (unsigned i = 0; i < num_keys; ++i) {
+        num_found += found[i] ? 1 : 0;
+    }
+    TEST_EQUAL(tr, num_found, num_keys);
+
+    // batched and scalar lookups agree and there are few false positives
+    batch_filter.contains_batch(others.data(), num_keys, found.get());
+    unsigned num_false_positives = 0;
+    for (unsigned i = 0; i < num_keys; ++i) {
+        TEST_EQUAL(tr, found[i], batch_filter.contains(others[i]));
+        num_false_positives += found[i] ? 1 : 0;
+    }
+    TEST_EQUAL(tr, num_false_positives < num_keys / 50, true);
+}
+
+void test_algorithm_blocked_bloom(TestReporter& tr)
+{
+    test_blocked_bloom_single_key(tr);
+    test_blocked_bloom_batch(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,97 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/crc32.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Bit-at-a-time reference implementation
+static uint32_t crc32_bitwise(uint32_t rpoly, const uint8_t* p, std::size_t len,
+                              uint32_t crc)
+{
+    uint32_t r = ~crc;
+    for (std::size_t i = 0; i < len; ++i) {
+        r ^= p[i];
+        for (unsigned j = 0; j < 8; ++j) {
+            r = (r & 1) ? (r >> 1) ^ rpoly : r >> 1;
+        }
+    }
+    return ~r;
+}
+
+void test_crc32_known_answers(TestReporter& tr)
+{
+    const char* check = "123456789";
+    TEST_EQUAL(tr, simdpp::crc32c(check, 9), 0xe3069283u);
+    TEST_EQUAL(tr, simdpp::crc32(check, 9), 0xcbf43926u);
+    TEST_EQUAL(tr, simdpp::crc32c(check, 0), 0u);
+    TEST_EQUAL(tr, simdpp::crc32(check, 0), 0u);
+
+    // RFC 3720 test vectors
+    uint8_t buf[32];
+    std::memset(buf, 0, sizeof(buf));
+    TEST_EQUAL(tr, simdpp::crc32c(buf, 32), 0x8a9136aau);
+    std::memset(buf, 0xff, sizeof(buf));
+    TEST_EQUAL(tr, simdpp::crc32c(buf, 32), 0x62a8ab43u);
+}
+
+void test_clmul_known_answers(TestReporter& tr)
+{
+    using namespace simdpp;
+    uint64<2> a = make_uint(0x8000000000000001ull, 0x3);
+    uint64<2> b = make_uint(0x3, 0xffffffffffffffffull);
+
+    uint64<2> lo = clmul_lo(a, b);
+    uint64<2> hi = clmul_hi(a, b);
+    TEST_EQUAL(tr, lo, uint64<2>(make_uint(0x8000000000000003ull, 0x1)));
+    TEST_EQUAL(tr, hi, uint64<2>(make_uint(0x1, 0x1)));
+}
+
+void test_crc32_random(TestReporter& tr)
+{
+    std::minstd_rand rng(42);
+    std::uniform_int_distribution<unsigned> dist(0, 255);
+
+    // Enough data to exercise the 128-byte and 16-byte folding loops with all
+    // possible tail lengths and misalignments
+    std::vector<uint8_t> data(700);
+    for (auto& b : data) {
+        b = static_cast<uint8_t>(dist(rng));
+    }
+
+    for (unsigned len = 0; len < 600; len += (len < 300 ? 1 : 13)) {
+        unsigned offset = len % 7;
+        const uint8_t* p = data.data() + offset;
+        uint32_t seed = len * 0x9e3779b1u;
+
+        TEST_EQUAL(tr, simdpp::crc32c(p, len, seed),
+                   crc32_bitwise(0x82f63b78u, p, len, seed));
+        TEST_EQUAL(tr, simdpp::crc32(p, len, seed),
+                   crc32_bitwise(0xedb88320u, p, len, seed));
+    }
+
+    // computing the checksum in chunks gives the same result
+    uint32_t c = 0;
+    c = simdpp::crc32c(data.data(), 200, c);
+    c = simdpp::crc32c(data.data() + 200, 500, c);
+    TEST_EQUAL(tr, c, simdpp::crc32c(data.data(), 700));
+}
+
+void test_algorithm_crc32(TestReporter& tr)
+{
+    test_clmul_known_answers(tr);
+    test_crc32_known_answers(tr);
+    test_crc32_random(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
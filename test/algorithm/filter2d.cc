@@ -0,0 +1,202 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/filter2d.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Reference separable filter with replicated borders, computed in double
+template<class T>
+std::vector<double> filter2d_reference(const std::vector<T>& src, std::size_t stride,
+                                       std::size_t w, std::size_t h,
+                                       const std::vector<double>& kx,
+                                       const std::vector<double>& ky)
+{
+    auto clamp = [](std::ptrdiff_t i, std::size_t n) {
+        return std::size_t(i < 0 ? 0 : (i >= std::ptrdiff_t(n) ? std::ptrdiff_t(n) - 1 : i));
+    };
+    std::ptrdiff_t rx = kx.size() / 2, ry = ky.size() / 2;
+    std::vector<double> r(w * h);
+    for (std::size_t y = 0; y < h; ++y) {
+        for (std::size_t x = 0; x < w; ++x) {
+            double sum = 0;
+            for (std::size_t j = 0; j < ky.size(); ++j) {
+                std::size_t sy = clamp(std::ptrdiff_t(y + j) - ry, h);
+                double row = 0;
+                for (std::size_t k = 0; k < kx.size(); ++k) {
+                    std::size_t sx = clamp(std::ptrdiff_t(x + k) - rx, w);
+                    row += kx[k] * double(src[sy * stride + sx]);
+                }
+                sum += ky[j] * row;
+            }
+            r[y * w + x] = sum;
+        }
+    }
+    return r;
+}
+
+struct filter2d_size { std::size_t w, h; };
+
+static const filter2d_size filter2d_sizes[] = {
+    { 1, 1 }, { 3, 2 }, { 17, 5 }, { 64, 9 }, { 100, 3 }, { 1400, 4 }
+};
+
+void test_filter2d_float(TestReporter& tr)
+{
+    std::minstd_rand rng(7);
+    std::uniform_int_distribution<int> dist(-50, 50);
+    std::uniform_int_distribution<int> kdist(-4, 4);
+
+    const std::size_t nk[][2] = { { 1, 1 }, { 3, 3 }, { 5, 1 }, { 1, 7 }, { 9, 5 } };
+    for (const auto& sz : filter2d_sizes) {
+        for (const auto& n : nk) {
+            // small integers: the sums are exact in any order
+            std::size_t stride = sz.w + 3;
+            std::vector<float> src(stride * sz.h);
+            for (auto& x : src) x = float(dist(rng));
+            std::vector<float> kx(n[0]), ky(n[1]);
+            std::vector<double> dkx(n[0]), dky(n[1]);
+            for (std::size_t i = 0; i < n[0]; ++i) dkx[i] = kx[i] = float(kdist(rng));
+            for (std::size_t i = 0; i < n[1]; ++i) dky[i] = ky[i] = float(kdist(rng));
+
+            std::vector<double> ref = filter2d_reference(src, stride, sz.w, sz.h, dkx, dky);
+            std::vector<float> expected(stride * sz.h, -1.0f), out(stride * sz.h, -1.0f);
+            for (std::size_t y = 0; y < sz.h; ++y) {
+                for (std::size_t x = 0; x < sz.w; ++x) {
+                    expected[y * stride + x] = float(ref[y * sz.w + x]);
+                }
+            }
+
+            simdpp::separable_filter(src.data(), stride, out.data(), stride, sz.w, sz.h,
+                                     kx.data(), n[0], ky.data(), n[1]);
+            // the padding at the ends of the rows is not modified
+            TEST_EQUAL_MEMORY(tr, out.data(), expected.data(), out.size());
+        }
+    }
+
+    // the presets are checked within a tolerance
+    for (const auto& sz : filter2d_sizes) {
+        std::vector<float> src(sz.w * sz.h), out(sz.w * sz.h);
+        for (auto& x : src) x = float(dist(rng));
+
+        simdpp::gaussian_filter(src.data(), sz.w, out.data(), sz.w, sz.w, sz.h, 1.5f);
+        std::vector<float> k = simdpp::detail::filter_gaussian_kernel(1.5f);
+        std::vector<double> dk(k.begin(), k.end());
+        std::vector<double> ref = filter2d_reference(src, sz.w, sz.w, sz.h, dk, dk);
+        for (std::size_t i = 0; i < ref.size(); ++i) {
+            TEST_EQUAL(tr, std::abs(out[i] - ref[i]) < 1e-3, true);
+        }
+
+        simdpp::sobel_y(src.data(), sz.w, out.data(), sz.w, sz.w, sz.h);
+        ref = filter2d_reference(src, sz.w, sz.w, sz.h, { 1, 2, 1 }, { -1, 0, 1 });
+        for (std::size_t i = 0; i < ref.size(); ++i) {
+            TEST_EQUAL(tr, double(out[i]), ref[i]);
+        }
+    }
+}
+
+// Checks the 8 and 16-bit outputs of the integer separable filter. The
+// results are rounded, shifted and saturated to the output type.
+void test_filter2d_u8_kernel(TestReporter& tr, const std::vector<uint8_t>& src,
+                             std::size_t stride, const filter2d_size& sz,
+                             const std::vector<int16_t>& kx,
+                             const std::vector<int16_t>& ky, unsigned shift)
+{
+    std::vector<double> dkx(kx.begin(), kx.end()), dky(ky.begin(), ky.end());
+    std::vector<double> ref = filter2d_reference(src, stride, sz.w, sz.h, dkx, dky);
+    std::vector<uint8_t> expected8(stride * sz.h, 7), out8(stride * sz.h, 7);
+    std::vector<int16_t> expected16(stride * sz.h, 7), out16(stride * sz.h, 7);
+    for (std::size_t y = 0; y < sz.h; ++y) {
+        for (std::size_t x = 0; x < sz.w; ++x) {
+            // the sums are exact integers
+            long v = (long(ref[y * sz.w + x]) + (1 << (shift - 1))) >> shift;
+            expected8[y * stride + x] = uint8_t(v < 0 ? 0 : (v > 255 ? 255 : v));
+            expected16[y * stride + x] = int16_t(v < -32768 ? -32768 : (v > 32767 ? 32767 : v));
+        }
+    }
+
+    simdpp::separable_filter(src.data(), stride, out8.data(), stride, sz.w, sz.h,
+                             kx.data(), kx.size(), ky.data(), ky.size(), shift);
+    TEST_EQUAL_MEMORY(tr, out8.data(), expected8.data(), out8.size());
+    simdpp::separable_filter(src.data(), stride, out16.data(), stride, sz.w, sz.h,
+                             kx.data(), kx.size(), ky.data(), ky.size(), shift);
+    TEST_EQUAL_MEMORY(tr, out16.data(), expected16.data(), out16.size());
+}
+
+void test_filter2d_u8(TestReporter& tr)
+{
+    std::minstd_rand rng(9);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::uniform_int_distribution<int> kdist(-8, 8);
+
+    const std::size_t nk[][2] = { { 1, 1 }, { 3, 3 }, { 5, 1 }, { 1, 7 }, { 9, 5 } };
+    for (const auto& sz : filter2d_sizes) {
+        for (const auto& n : nk) {
+            std::size_t stride = sz.w + 5;
+            std::vector<uint8_t> src(stride * sz.h);
+            for (auto& x : src) x = uint8_t(dist(rng));
+            std::vector<int16_t> kx(n[0]), ky(n[1]);
+            for (auto& k : kx) k = int16_t(kdist(rng));
+            for (auto& k : ky) k = int16_t(kdist(rng));
+            test_filter2d_u8_kernel(tr, src, stride, sz, kx, ky, 4);
+        }
+    }
+
+    // the results exceed the range of int16_t in both directions
+    for (const auto& sz : filter2d_sizes) {
+        std::size_t stride = sz.w + 5;
+        std::vector<uint8_t> src(stride * sz.h);
+        for (auto& x : src) x = uint8_t(dist(rng) | 0xc0);
+        test_filter2d_u8_kernel(tr, src, stride, sz, { 32, 64, 32 }, { 16, 16, 16 }, 4);
+        test_filter2d_u8_kernel(tr, src, stride, sz, { 32, 64, 32 }, { -16, -16, -16 }, 4);
+    }
+
+    for (const auto& sz : filter2d_sizes) {
+        std::vector<uint8_t> src(sz.w * sz.h), out(sz.w * sz.h);
+        for (auto& x : src) x = uint8_t(dist(rng));
+
+        // the mean is within one of the exact value
+        for (unsigned radius : { 0u, 1u, 2u, 7u }) {
+            simdpp::box_filter(src.data(), sz.w, out.data(), sz.w, sz.w, sz.h, radius);
+            std::vector<double> k(2 * radius + 1, 1.0 / (2 * radius + 1));
+            std::vector<double> ref = filter2d_reference(src, sz.w, sz.w, sz.h, k, k);
+            for (std::size_t i = 0; i < ref.size(); ++i) {
+                TEST_EQUAL(tr, std::abs(out[i] - ref[i]) <= 1.0, true);
+            }
+        }
+
+        simdpp::gaussian_filter(src.data(), sz.w, out.data(), sz.w, sz.w, sz.h, 1.0f);
+        std::vector<float> k = simdpp::detail::filter_gaussian_kernel(1.0f);
+        std::vector<double> dk(k.begin(), k.end());
+        std::vector<double> ref = filter2d_reference(src, sz.w, sz.w, sz.h, dk, dk);
+        for (std::size_t i = 0; i < ref.size(); ++i) {
+            TEST_EQUAL(tr, std::abs(out[i] - ref[i]) <= 2.0, true);
+        }
+
+        std::vector<int16_t> out16(sz.w * sz.h);
+        simdpp::sobel_x(src.data(), sz.w, out16.data(), sz.w, sz.w, sz.h);
+        ref = filter2d_reference(src, sz.w, sz.w, sz.h, { -1, 0, 1 }, { 1, 2, 1 });
+        for (std::size_t i = 0; i < ref.size(); ++i) {
+            TEST_EQUAL(tr, double(out16[i]), ref[i]);
+        }
+    }
+}
+
+void test_algorithm_filter2d(TestReporter& tr)
+{
+    test_filter2d_float(tr);
+    test_filter2d_u8(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
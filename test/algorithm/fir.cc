@@ -0,0 +1,56 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/fir.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T, class R>
+void test_fir_type(TestReporter& tr, int range)
+{
+    std::minstd_rand rng(21);
+    std::uniform_int_distribution<int> dist(-range, range);
+
+    // the specialized tap counts and the generic filter
+    const std::size_t ntaps_list[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 31 };
+    const std::size_t sizes[] = { 0, 1, 7, 16, 33, 64, 100, 257 };
+    for (std::size_t ntaps : ntaps_list) {
+        for (std::size_t n : sizes) {
+            std::vector<T> in(n + ntaps - 1), taps(ntaps);
+            for (auto& x : in) x = T(dist(rng));
+            for (auto& x : taps) x = T(dist(rng));
+
+            // small integers: the float sums are exact in any order
+            std::vector<R> expected(n + 1, R(-5)), out(n + 1, R(-5));
+            for (std::size_t i = 0; i < n; ++i) {
+                R sum = 0;
+                for (std::size_t k = 0; k < ntaps; ++k) {
+                    sum += R(taps[k]) * R(in[i + ntaps - 1 - k]);
+                }
+                expected[i] = sum;
+            }
+
+            simdpp::fir_filter(in.data(), n, taps.data(), ntaps, out.data());
+            // the element past the end is not modified
+            TEST_EQUAL_MEMORY(tr, out.data(), expected.data(), n + 1);
+        }
+    }
+}
+
+void test_algorithm_fir(TestReporter& tr)
+{
+    test_fir_type<float, float>(tr, 100);
+    test_fir_type<int16_t, int32_t>(tr, 8000);
+    test_fir_type<int32_t, int32_t>(tr, 1000);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,121 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/gemm.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T>
+void test_gemm_size(TestReporter& tr, std::size_t m, std::size_t n, std::size_t k,
+                    T alpha, T beta)
+{
+    std::minstd_rand rng(unsigned(m * 131 + n * 17 + k));
+    std::uniform_int_distribution<int> dist(-8, 8);
+
+    // padded strides
+    std::size_t lda = k + 3, ldb = n + 1, ldc = n + 2;
+    std::vector<T> a(m * lda), b(k * ldb), c(m * ldc), expected(m * ldc);
+    for (auto& x : a) x = T(dist(rng)) / 4;
+    for (auto& x : b) x = T(dist(rng)) / 4;
+    for (auto& x : c) x = beta != T(0) ? T(dist(rng)) : std::numeric_limits<T>::quiet_NaN();
+    expected = c;
+
+    // The elements are small multiples of powers of two, thus the products
+    // and sums are exact regardless of the order of the operations
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T sum = 0;
+            for (std::size_t p = 0; p < k; ++p) {
+                sum += a[i * lda + p] * b[p * ldb + j];
+            }
+            T& e = expected[i * ldc + j];
+            if (alpha == T(0)) {
+                e = beta * e;
+            } else {
+                e = beta != T(0) ? alpha * sum + beta * e : alpha * sum;
+            }
+        }
+    }
+
+    simdpp::gemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, c.data(), ldc);
+    for (std::size_t i = 0; i < m; ++i) {
+        TEST_EQUAL_MEMORY(tr, c.data() + i * ldc, expected.data() + i * ldc, n);
+        // the padding is not modified
+        TEST_EQUAL_MEMORY(tr, c.data() + i * ldc + n, expected.data() + i * ldc + n, 2);
+    }
+}
+
+template<class T>
+void test_gemv_size(TestReporter& tr, std::size_t m, std::size_t n, T alpha, T beta)
+{
+    std::minstd_rand rng(unsigned(m * 7 + n));
+    std::uniform_int_distribution<int> dist(-8, 8);
+
+    std::size_t lda = n + 1;
+    std::vector<T> a(m * lda), x(n), y(m), expected(m);
+    for (auto& v : a) v = T(dist(rng)) / 4;
+    for (auto& v : x) v = T(dist(rng)) / 4;
+    for (auto& v : y) v = beta != T(0) ? T(dist(rng)) : std::numeric_limits<T>::quiet_NaN();
+
+    for (std::size_t i = 0; i < m; ++i) {
+        T sum = 0;
+        for (std::size_t j = 0; j < n; ++j) {
+            sum += a[i * lda + j] * x[j];
+        }
+        expected[i] = beta != T(0) ? alpha * sum + beta * y[i] : alpha * sum;
+    }
+
+    simdpp::gemv(m, n, alpha, a.data(), lda, x.data(), beta, y.data());
+    TEST_EQUAL_MEMORY(tr, y.data(), expected.data(), m);
+}
+
+template<class T>
+void test_gemm_type(TestReporter& tr)
+{
+    // sizes around the sizes of the register blocks and the cache blocks
+    const std::size_t ms[] = { 1, 4, 5, 6, 7, 13, 14, 15, 29 };
+    const std::size_t ns[] = { 1, 7, 8, 16, 17, 33, 65 };
+    const std::size_t ks[] = { 0, 1, 3, 40 };
+    for (std::size_t m : ms) {
+        for (std::size_t n : ns) {
+            for (std::size_t k : ks) {
+                test_gemm_size<T>(tr, m, n, k, T(1), T(0));
+            }
+            test_gemm_size<T>(tr, m, n, 9, T(-2), T(0.5));
+        }
+    }
+    test_gemm_size<T>(tr, 250, 70, 300, T(0.5), T(1));
+    test_gemm_size<T>(tr, 30, 2100, 20, T(1), T(2));
+    // larger than the upper bounds of the cache blocks, which depend on the
+    // cache sizes of the processor otherwise
+    test_gemm_size<T>(tr, 1000, 20, 300, T(1), T(0));
+    test_gemm_size<T>(tr, 3, 9000, 20, T(1), T(0));
+    test_gemm_size<T>(tr, 3, 4, 5, T(0), T(-1));
+
+    const std::size_t gs[] = { 0, 1, 3, 4, 5, 8, 17, 64, 101 };
+    for (std::size_t m : gs) {
+        for (std::size_t n : gs) {
+            test_gemv_size<T>(tr, m, n, T(1), T(0));
+            test_gemv_size<T>(tr, m, n, T(-0.5), T(2));
+        }
+    }
+}
+
+void test_algorithm_gemm(TestReporter& tr)
+{
+    test_gemm_type<float>(tr);
+    test_gemm_type<double>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,109 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/hash.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void test_hash_scalar_reference(TestReporter& tr)
+{
+    // Reference values computed with XXH32 and XXH64 of little-endian keys
+    TEST_EQUAL(tr, simdpp::hash32_scalar(0u, 0u), 0x08d6d969u);
+    TEST_EQUAL(tr, simdpp::hash32_scalar(1u, 0u), 0xf3bb7693u);
+    TEST_EQUAL(tr, simdpp::hash32_scalar(0xdeadbeefu, 0u), 0xe4aae6d1u);
+    TEST_EQUAL(tr, simdpp::hash32_scalar(0x12345678u, 0x9747b28cu), 0x84519465u);
+
+    TEST_EQUAL(tr, simdpp::hash64_scalar(0ull, 0ull), 0x34c96acdcadb1bbbull);
+    TEST_EQUAL(tr, simdpp::hash64_scalar(1ull, 0ull), 0x9f29cb17a2a49995ull);
+    TEST_EQUAL(tr, simdpp::hash64_scalar(0x0123456789abcdefull, 0ull),
+               0xea3c52081e9843ecull);
+    TEST_EQUAL(tr, simdpp::hash64_scalar(0xfedcba9876543210ull, 0x9747b28cull),
+               0xd5ea593993721a19ull);
+}
+
+template<class E, class F, class G>
+void test_hash_batch_impl(TestReporter& tr, F batch_fn, G scalar_fn, E seed)
+{
+    std::minstd_rand rng(123);
+    std::uniform_int_distribution<E> dist;
+
+    // Test sizes that exercise the unrolled loop, single vector loop and the
+    // scalar tail.
+    for (unsigned n = 0; n < 100; n += 7) {
+        std::vector<E> keys(n), out(n), expected(n);
+        for (unsigned i = 0; i < n; ++i) {
+            keys[i] = dist(rng);
+            expected[i] = scalar_fn(keys[i], seed);
+        }
+        batch_fn(keys.data(), out.data(), n, seed);
+        TEST_EQUAL_MEMORY(tr, out.data(), expected.data(), n);
+    }
+}
+
+template<unsigned N>
+void test_hash32_vec_impl(TestReporter& tr)
+{
+    std::minstd_rand rng(321);
+    std::uniform_int_distribution<uint32_t> dist;
+
+    for (unsigned iter = 0; iter < 100; ++iter) {
+        uint32_t keys[N], expected[N];
+        for (unsigned i = 0; i < N; ++i) {
+            keys[i] = dist(rng);
+            expected[i] = simdpp::hash32_scalar(keys[i], iter);
+        }
+        simdpp::uint32<N> r = simdpp::hash32(simdpp::uint32<N>(simdpp::load_u(keys)), iter);
+        TEST_EQUAL(tr, r, simdpp::uint32<N>(simdpp::load_u(expected)));
+    }
+}
+
+template<unsigned N>
+void test_hash64_vec_impl(TestReporter& tr)
+{
+    std::minstd_rand rng(321);
+    std::uniform_int_distribution<uint64_t> dist;
+
+    for (unsigned iter = 0; iter < 100; ++iter) {
+        uint64_t keys[N], expected[N];
+        for (unsigned i = 0; i < N; ++i) {
+            keys[i] = dist(rng);
+            expected[i] = simdpp::hash64_scalar(keys[i], iter);
+        }
+        simdpp::uint64<N> r = simdpp::hash64(simdpp::uint64<N>(simdpp::load_u(keys)), iter);
+        TEST_EQUAL(tr, r, simdpp::uint64<N>(simdpp::load_u(expected)));
+    }
+}
+
+void test_algorithm_hash(TestReporter& tr)
+{
+    test_hash_scalar_reference(tr);
+
+    test_hash32_vec_impl<4>(tr);
+    test_hash32_vec_impl<8>(tr);
+    test_hash32_vec_impl<16>(tr);
+    test_hash64_vec_impl<2>(tr);
+    test_hash64_vec_impl<4>(tr);
+    test_hash64_vec_impl<8>(tr);
+
+    test_hash_batch_impl<uint32_t>(tr,
+        [](const uint32_t* k, uint32_t* o, std::size_t n, uint32_t s)
+        { simdpp::hash32_batch(k, o, n, s); },
+        [](uint32_t k, uint32_t s) { return simdpp::hash32_scalar(k, s); },
+        0x9747b28cu);
+    test_hash_batch_impl<uint64_t>(tr,
+        [](const uint64_t* k, uint64_t* o, std::size_t n, uint64_t s)
+        { simdpp::hash64_batch(k, o, n, s); },
+        [](uint64_t k, uint64_t s) { return simdpp::hash64_scalar(k, s); },
+        0x9747b28cull);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
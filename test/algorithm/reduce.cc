@@ -0,0 +1,233 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/reduce.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T> struct reduce_ref_uint;
+template<> struct reduce_ref_uint<int16_t> { using type = uint16_t; };
+template<> struct reduce_ref_uint<uint16_t> { using type = uint16_t; };
+template<> struct reduce_ref_uint<int32_t> { using type = uint32_t; };
+template<> struct reduce_ref_uint<uint32_t> { using type = uint32_t; };
+template<> struct reduce_ref_uint<int64_t> { using type = uint64_t; };
+template<> struct reduce_ref_uint<uint64_t> { using type = uint64_t; };
+
+// R is the result type of reduce_add and reduce_mul
+template<class T, class R>
+void test_reduce_int_type(TestReporter& tr)
+{
+    using U = typename reduce_ref_uint<R>::type;
+    std::minstd_rand rng(11);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+
+    const unsigned sizes[] = { 0, 1, 2, 7, 16, 31, 64, 65, 100, 255, 1000 };
+    for (unsigned n : sizes) {
+        std::vector<T> a(n);
+        for (auto& x : a) {
+            x = T(dist(rng));
+        }
+        // the maximum is sometimes at the end of the array
+        if (n > 2 && n % 2 == 0) {
+            a[n - 1] = std::numeric_limits<T>::max();
+        }
+
+        U sum = 0, prod = 1;
+        T mn = std::numeric_limits<T>::max();
+        T mx = std::numeric_limits<T>::lowest();
+        for (T x : a) {
+            sum = U(sum + U(R(x)));
+            prod = U(prod * U(R(x)));
+            mn = std::min(mn, x);
+            mx = std::max(mx, x);
+        }
+
+        TEST_EQUAL(tr, simdpp::reduce_add(a.data(), n), R(sum));
+        TEST_EQUAL(tr, simdpp::reduce_mul(a.data(), n), R(prod));
+        TEST_EQUAL(tr, simdpp::reduce_min(a.data(), n), mn);
+        TEST_EQUAL(tr, simdpp::reduce_max(a.data(), n), mx);
+
+        auto mm = simdpp::minmax_element(a.data(), n);
+        auto emm = std::minmax_element(a.data(), a.data() + n);
+        TEST_EQUAL(tr, std::size_t(mm.first - a.data()), std::size_t(emm.first - a.data()));
+        TEST_EQUAL(tr, std::size_t(mm.second - a.data()), std::size_t(emm.second - a.data()));
+    }
+}
+
+template<class T>
+void test_reduce_float_type(TestReporter& tr)
+{
+    std::minstd_rand rng(12);
+    std::uniform_int_distribution<int> dist(-100, 100);
+
+    const unsigned sizes[] = { 0, 1, 3, 8, 33, 100, 1000 };
+    for (unsigned n : sizes) {
+        // small integers are summed exactly in any order
+        std::vector<T> a(n);
+        T sum = 0, mn = std::numeric_limits<T>::infinity();
+        T mx = -std::numeric_limits<T>::infinity();
+        for (auto& x : a) {
+            x = T(dist(rng));
+            sum += x;
+            mn = std::min(mn, x);
+            mx = std::max(mx, x);
+        }
+        TEST_EQUAL(tr, simdpp::reduce_add(a.data(), n), sum);
+        TEST_EQUAL(tr, simdpp::reduce_add(a.data(), n, simdpp::reduce_mode::compensated), sum);
+        TEST_EQUAL(tr, simdpp::reduce_min(a.data(), n), mn);
+        TEST_EQUAL(tr, simdpp::reduce_max(a.data(), n), mx);
+
+        auto mm = simdpp::minmax_element(a.data(), n);
+        auto emm = std::minmax_element(a.data(), a.data() + n);
+        TEST_EQUAL(tr, std::size_t(mm.first - a.data()), std::size_t(emm.first - a.data()));
+        TEST_EQUAL(tr, std::size_t(mm.second - a.data()), std::size_t(emm.second - a.data()));
+
+        // powers of two are multiplied exactly
+        std::vector<T> b(n);
+        T prod = 1;
+        for (unsigned i = 0; i < n; ++i) {
+            b[i] = (i % 3 == 0) ? T(2) : (i % 3 == 1 ? T(0.5) : T(1));
+            prod *= b[i];
+        }
+        TEST_EQUAL(tr, simdpp::reduce_mul(b.data(), n), prod);
+    }
+
+    // Large values that cancel out. The small values are lost entirely unless
+    // the rounding errors are compensated.
+    std::vector<T> c;
+    T big = T(1) / std::numeric_limits<T>::epsilon();
+    for (unsigned i = 0; i < 256; ++i) {
+        c.push_back(big);
+        c.push_back(T(1));
+        c.push_back(-big);
+    }
+    TEST_EQUAL(tr, simdpp::reduce_add(c.data(), c.size(), simdpp::reduce_mode::compensated), T(256));
+}
+
+void test_compensated_float(TestReporter& tr)
+{
+    std::minstd_rand rng(13);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    // The error of the results computed in twice the working precision is
+    // bounded by eps*|r| + (n*eps)^2 * sum(|x_i|). The reference computed in
+    // double precision is much more accurate than that.
+    const unsigned sizes[] = { 0, 1, 5, 32, 77, 1000, 4099 };
+    for (unsigned n : sizes) {
+        std::vector<float> a(n), b(n);
+        double sum = 0, dot = 0, sum_abs = 0, dot_abs = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            // wide range of magnitudes with cancellation
+            a[i] = dist(rng) * float(1 << (i % 24));
+            b[i] = dist(rng);
+            sum += a[i];
+            dot += double(a[i]) * double(b[i]);
+            sum_abs += std::abs(a[i]);
+            dot_abs += std::abs(double(a[i]) * double(b[i]));
+        }
+        double eps = std::numeric_limits<float>::epsilon();
+        double gamma2 = (n * eps) * (n * eps);
+
+        float r = simdpp::sum_compensated(a.data(), n);
+        TEST_EQUAL(tr, std::abs(r - sum) <= eps * std::abs(sum) + gamma2 * sum_abs, true);
+        r = simdpp::dot_compensated(a.data(), b.data(), n);
+        TEST_EQUAL(tr, std::abs(r - dot) <= eps * std::abs(dot) + 2 * gamma2 * dot_abs, true);
+    }
+}
+
+template<class T>
+void test_compensated_cancellation(TestReporter& tr)
+{
+    // The result is lost entirely in the rounding errors unless they are
+    // compensated
+    std::vector<T> a, b;
+    T big = T(1) / std::numeric_limits<T>::epsilon();
+    for (unsigned i = 0; i < 100; ++i) {
+        a.push_back(big);
+        a.push_back(T(1));
+        a.push_back(-big);
+        b.push_back(big);
+        b.push_back(T(3));
+        b.push_back(big);
+    }
+    TEST_EQUAL(tr, simdpp::sum_compensated(a.data(), a.size()), T(100));
+    TEST_EQUAL(tr, simdpp::dot_compensated(a.data(), b.data(), a.size()), T(300));
+
+    // rounding errors of products: (1 + eps) * (1 - eps) - 1 = -eps^2
+    T eps = std::numeric_limits<T>::epsilon();
+    T x[3] = { 1 + eps, T(-1), T(0) };
+    T y[3] = { 1 - eps, T(1), T(0) };
+    TEST_EQUAL(tr, simdpp::dot_compensated(x, y, 3), -eps * eps);
+}
+
+// Scalar reference of the summation order of reduce_mode::deterministic
+template<class T>
+T reduce_deterministic_ref(const std::vector<T>& a)
+{
+    T acc[2][16] = {};
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        acc[(i / 16) % 2][i % 16] += a[i];
+    }
+    T m[16];
+    for (unsigned j = 0; j < 16; ++j) {
+        m[j] = acc[0][j] + acc[1][j];
+    }
+    for (unsigned w = 8; w > 0; w /= 2) {
+        for (unsigned j = 0; j < w; ++j) {
+            m[j] = m[j] + m[j + w];
+        }
+    }
+    return m[0];
+}
+
+template<class T>
+void test_reduce_deterministic(TestReporter& tr)
+{
+    std::minstd_rand rng(14);
+    std::uniform_real_distribution<T> dist(-1, 1);
+
+    // The results must match the reference bit by bit on all architectures
+    const unsigned sizes[] = { 0, 1, 15, 16, 17, 31, 32, 33, 48, 50, 1000, 1031 };
+    for (unsigned n : sizes) {
+        std::vector<T> a(n);
+        for (unsigned i = 0; i < n; ++i) {
+            a[i] = dist(rng) * T(1 << (i % 20));
+        }
+        T r = simdpp::reduce_add(a.data(), n, simdpp::reduce_mode::deterministic);
+        T ref = reduce_deterministic_ref(a);
+        TEST_EQUAL_MEMORY(tr, &r, &ref, 1);
+    }
+}
+
+void test_algorithm_reduce(TestReporter& tr)
+{
+    test_reduce_deterministic<float>(tr);
+    test_reduce_deterministic<double>(tr);
+    test_compensated_float(tr);
+    test_compensated_cancellation<float>(tr);
+    test_compensated_cancellation<double>(tr);
+    test_reduce_int_type<int8_t, int16_t>(tr);
+    test_reduce_int_type<uint8_t, uint16_t>(tr);
+    test_reduce_int_type<int16_t, int32_t>(tr);
+    test_reduce_int_type<uint16_t, uint32_t>(tr);
+    test_reduce_int_type<int32_t, int32_t>(tr);
+    test_reduce_int_type<uint32_t, uint32_t>(tr);
+    test_reduce_int_type<int64_t, int64_t>(tr);
+    test_reduce_int_type<uint64_t, uint64_t>(tr);
+    test_reduce_float_type<float>(tr);
+    test_reduce_float_type<double>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
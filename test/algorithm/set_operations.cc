@@ -0,0 +1,107 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/set_operations.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T>
+std::vector<T> make_sorted_set(std::minstd_rand& rng, std::size_t n, T range)
+{
+    std::uniform_int_distribution<T> dist(0, range);
+    std::vector<T> r(n);
+    for (auto& x : r) {
+        x = dist(rng);
+    }
+    std::sort(r.begin(), r.end());
+    r.erase(std::unique(r.begin(), r.end()), r.end());
+    return r;
+}
+
+template<class T>
+void test_set_operations_pair(TestReporter& tr, const std::vector<T>& a,
+                              const std::vector<T>& b)
+{
+    std::vector<T> expected, out(a.size() + b.size() + 1);
+    std::size_t n;
+
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                          std::back_inserter(expected));
+    n = simdpp::set_intersection(a.data(), a.size(), b.data(), b.size(), out.data());
+    TEST_EQUAL(tr, n, expected.size());
+    TEST_EQUAL_MEMORY(tr, out.data(), expected.data(), expected.size());
+
+    expected.clear();
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+                   std::back_inserter(expected));
+    n = simdpp::set_union(a.data(), a.size(), b.data(), b.size(), out.data());
+    TEST_EQUAL(tr, n, expected.size());
+    TEST_EQUAL_MEMORY(tr, out.data(), expected.data(), expected.size());
+
+    expected.clear();
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                        std::back_inserter(expected));
+    n = simdpp::set_difference(a.data(), a.size(), b.data(), b.size(), out.data());
+    TEST_EQUAL(tr, n, expected.size());
+    TEST_EQUAL_MEMORY(tr, out.data(), expected.data(), expected.size());
+}
+
+template<class T>
+void test_set_operations_type(TestReporter& tr)
+{
+    std::minstd_rand rng(17);
+
+    // empty inputs
+    std::vector<T> empty, some = make_sorted_set<T>(rng, 20, 100);
+    test_set_operations_pair(tr, empty, empty);
+    test_set_operations_pair(tr, empty, some);
+    test_set_operations_pair(tr, some, empty);
+    test_set_operations_pair(tr, some, some);
+
+    // sparse and dense overlap, similar sizes
+    for (unsigned iter = 0; iter < 20; ++iter) {
+        T range = iter % 2 ? 300 : 3000;
+        auto a = make_sorted_set<T>(rng, 50 + iter * 13, range);
+        auto b = make_sorted_set<T>(rng, 40 + iter * 17, range);
+        test_set_operations_pair(tr, a, b);
+        test_set_operations_pair(tr, b, a);
+    }
+
+    // very different sizes exercising galloping search
+    for (unsigned iter = 0; iter < 10; ++iter) {
+        auto a = make_sorted_set<T>(rng, 5 + iter, 20000);
+        auto b = make_sorted_set<T>(rng, 4000, 20000);
+        a.push_back(b.back());
+        std::sort(a.begin(), a.end());
+        a.erase(std::unique(a.begin(), a.end()), a.end());
+        test_set_operations_pair(tr, a, b);
+        test_set_operations_pair(tr, b, a);
+    }
+
+    // values with the upper bits set
+    std::vector<T> hi_a, hi_b;
+    for (unsigned i = 0; i < 64; ++i) {
+        hi_a.push_back(T(~T(0)) - T(200) + T(i * 3));
+        hi_b.push_back(T(~T(0)) - T(200) + T(i * 2));
+    }
+    test_set_operations_pair(tr, hi_a, hi_b);
+}
+
+void test_algorithm_set_operations(TestReporter& tr)
+{
+    test_set_operations_type<uint32_t>(tr);
+    test_set_operations_type<uint64_t>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
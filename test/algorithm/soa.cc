@@ -0,0 +1,115 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/soa.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<unsigned M, class T>
+void test_soa_fields(TestReporter& tr)
+{
+    // sizes around the vector and block sizes, with aligned and unaligned
+    // arrays of structures
+    const std::size_t sizes[] = { 0, 1, 2, 3, 5, 8, 15, 16, 17, 31, 32, 33, 64, 67, 200 };
+    for (std::size_t n : sizes) {
+        for (std::size_t off = 0; off < 2; ++off) {
+            std::vector<T, simdpp::aligned_allocator<T, 64>> aos(n * M + off + 1);
+            std::vector<std::vector<T>> soa(M, std::vector<T>(n + 1, T(0x5a)));
+            std::vector<std::vector<T>> expected(M, std::vector<T>(n + 1, T(0x5a)));
+            for (std::size_t i = 0; i < n * M; ++i) {
+                aos[off + i] = T(i * 7 + 1);
+                expected[i % M][i / M] = aos[off + i];
+            }
+
+            T* dst[M];
+            for (unsigned f = 0; f < M; ++f) {
+                dst[f] = soa[f].data();
+            }
+            simdpp::aos_to_soa<M>(aos.data() + off, n, dst);
+            for (unsigned f = 0; f < M; ++f) {
+                // the elements past the end are not modified
+                TEST_EQUAL_MEMORY(tr, soa[f].data(), expected[f].data(), n + 1);
+            }
+
+            std::vector<T, simdpp::aligned_allocator<T, 64>> back(n * M + off + 1, T(0x33));
+            const T* src[M];
+            for (unsigned f = 0; f < M; ++f) {
+                src[f] = soa[f].data();
+            }
+            simdpp::soa_to_aos<M>(src, n, back.data() + off);
+            TEST_EQUAL_MEMORY(tr, back.data() + off, aos.data() + off, n * M);
+            TEST_EQUAL(tr, back[n * M + off], T(0x33));
+        }
+    }
+}
+
+template<class T>
+void test_soa_type(TestReporter& tr)
+{
+    test_soa_fields<2, T>(tr);
+    test_soa_fields<3, T>(tr);
+    test_soa_fields<4, T>(tr);
+    test_soa_fields<5, T>(tr);
+    test_soa_fields<6, T>(tr);
+    test_soa_fields<7, T>(tr);
+    test_soa_fields<8, T>(tr);
+}
+
+void test_soa_vector(TestReporter& tr)
+{
+    struct particle {
+        float x, y, z;
+        uint32_t id;
+    };
+
+    std::vector<particle> records;
+    for (unsigned i = 0; i < 100; ++i) {
+        records.push_back({ float(i), float(i) * 2, float(i) * 3, i + 1000 });
+    }
+
+    simdpp::soa_vector<float, float, float, uint32_t> soa;
+    TEST_EQUAL(tr, soa.empty(), true);
+    soa.from_aos(records.data(), records.size());
+    TEST_EQUAL(tr, soa.size(), std::size_t(100));
+    TEST_EQUAL(tr, reinterpret_cast<std::uintptr_t>(soa.data<2>()) % 64, std::uintptr_t(0));
+    for (unsigned i = 0; i < 100; ++i) {
+        TEST_EQUAL(tr, soa.get<0>(i), records[i].x);
+        TEST_EQUAL(tr, soa.data<1>()[i], records[i].y);
+        TEST_EQUAL(tr, soa.get<2>(i), records[i].z);
+        TEST_EQUAL(tr, soa.get<3>(i), records[i].id);
+    }
+
+    soa.push_back(1.0f, 2.0f, 3.0f, 7u);
+    TEST_EQUAL(tr, soa.size(), std::size_t(101));
+    TEST_EQUAL(tr, soa.get<3>(100), uint32_t(7));
+
+    std::vector<particle> back(101);
+    soa.to_aos(back.data());
+    TEST_EQUAL_MEMORY(tr, reinterpret_cast<const uint32_t*>(back.data()),
+                      reinterpret_cast<const uint32_t*>(records.data()), 400);
+    TEST_EQUAL(tr, back[100].z, 3.0f);
+
+    soa.clear();
+    TEST_EQUAL(tr, soa.size(), std::size_t(0));
+}
+
+void test_algorithm_soa(TestReporter& tr)
+{
+    test_soa_type<uint8_t>(tr);
+    test_soa_type<uint16_t>(tr);
+    test_soa_type<uint32_t>(tr);
+    test_soa_type<uint64_t>(tr);
+    test_soa_fields<3, float>(tr);
+    test_soa_fields<8, double>(tr);
+    test_soa_vector(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
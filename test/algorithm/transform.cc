@@ -0,0 +1,133 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/transform.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void test_transform_binary(TestReporter& tr)
+{
+    using namespace simdpp;
+    std::minstd_rand rng(5);
+    std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+
+    // All offsets of the output relative to the vector alignment and lengths
+    // around multiples of the unrolled step
+    const unsigned sizes[] = { 0, 1, 3, 4, 7, 16, 31, 32, 33, 63, 64, 65, 100, 257 };
+    for (unsigned n : sizes) {
+        for (unsigned off = 0; off < 4; ++off) {
+            std::vector<int32_t> a(n), b(n), expected(n);
+            std::vector<int32_t> out(n + off + 2, -7);
+            for (unsigned i = 0; i < n; ++i) {
+                a[i] = dist(rng);
+                b[i] = dist(rng);
+                expected[i] = a[i] * 3 + b[i] - 1;
+            }
+
+            simdpp::transform(out.data() + off, n,
+                [](int32<SIMDPP_FAST_INT32_SIZE> x, int32<SIMDPP_FAST_INT32_SIZE> y) {
+                    return x + x + x + y - 1;
+                }, a.data(), b.data());
+            TEST_EQUAL_MEMORY(tr, out.data() + off, expected.data(), n);
+
+            // nothing is written outside the output
+            for (unsigned i = 0; i < off; ++i) {
+                TEST_EQUAL(tr, out[i], -7);
+            }
+            TEST_EQUAL(tr, out[n + off], -7);
+            TEST_EQUAL(tr, out[n + off + 1], -7);
+        }
+    }
+}
+
+void test_transform_mixed(TestReporter& tr)
+{
+    using namespace simdpp;
+    // inputs and outputs of different element sizes
+    const unsigned n = 77;
+    std::vector<float> a(n), out(n + 1), expected(n);
+    std::vector<double> d(n), outd(n), expectedd(n);
+    for (unsigned i = 0; i < n; ++i) {
+        a[i] = float(i) * 0.5f;
+        d[i] = double(i) * 0.25;
+        expected[i] = a[i] * a[i] + 1.0f;
+        expectedd[i] = d[i] * 2.0 + d[i];
+    }
+
+    using F = float32<SIMDPP_FAST_FLOAT32_SIZE>;
+    simdpp::transform(out.data() + 1, n, [](F x) { return x * x + 1.0f; }, a.data());
+    TEST_EQUAL_MEMORY(tr, out.data() + 1, expected.data(), n);
+
+    using D = float64<SIMDPP_FAST_FLOAT64_SIZE>;
+    simdpp::transform(outd.data(), n, [](D x) { return x * 2.0 + x; }, d.data());
+    TEST_EQUAL_MEMORY(tr, outd.data(), expectedd.data(), n);
+
+    std::vector<uint8_t> b8(n), o8(n), e8(n);
+    for (unsigned i = 0; i < n; ++i) {
+        b8[i] = uint8_t(i * 7);
+        e8[i] = uint8_t(b8[i] ^ 0x5a);
+    }
+    using U8 = uint8<SIMDPP_FAST_INT8_SIZE>;
+    simdpp::transform(o8.data(), n, [](U8 x) { return bit_xor(x, 0x5a); }, b8.data());
+    TEST_EQUAL_MEMORY(tr, o8.data(), e8.data(), n);
+}
+
+void test_transform_reduce(TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned sizes[] = { 0, 1, 5, 16, 33, 100, 1001 };
+    for (unsigned n : sizes) {
+        std::vector<uint32_t> a(n), b(n);
+        uint32_t expected_dot = 0;
+        uint32_t expected_max = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            a[i] = (i * 2654435761u) % 1000;
+            b[i] = i % 13;
+            expected_dot += a[i] * b[i];
+            expected_max = std::max(expected_max, a[i] + b[i]);
+        }
+
+        using U = uint32<SIMDPP_FAST_INT32_SIZE>;
+        uint32_t dot = simdpp::transform_reduce(n, uint32_t(0),
+            [](U x, U y) { return x + y; },
+            [](U x, U y) { return mul_lo(x, y); }, a.data(), b.data());
+        TEST_EQUAL(tr, dot, expected_dot);
+
+        uint32_t mx = simdpp::transform_reduce(n, uint32_t(0),
+            [](U x, U y) { return max(x, y); },
+            [](U x, U y) { return x + y; }, a.data(), b.data());
+        TEST_EQUAL(tr, mx, expected_max);
+    }
+
+    // float sums of small integers are exact regardless of the order
+    std::vector<float> f(300);
+    float expected = 0;
+    for (unsigned i = 0; i < f.size(); ++i) {
+        f[i] = float(i % 17);
+        expected += f[i] * f[i];
+    }
+    using F = float32<SIMDPP_FAST_FLOAT32_SIZE>;
+    float sum = simdpp::transform_reduce(f.size(), 0.0f,
+        [](F x, F y) { return x + y; },
+        [](F x) { return x * x; }, f.data());
+    TEST_EQUAL(tr, sum, expected);
+}
+
+void test_algorithm_transform(TestReporter& tr)
+{
+    test_transform_binary(tr);
+    test_transform_mixed(tr);
+    test_transform_reduce(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
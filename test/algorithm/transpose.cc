@@ -0,0 +1,61 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/transpose.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T>
+void test_transpose_size(TestReporter& tr, std::size_t rows, std::size_t cols,
+                         std::size_t dst_off)
+{
+    std::vector<T> src(rows * cols), expected(rows * cols);
+    std::vector<T, simdpp::aligned_allocator<T, 64>> dst(rows * cols + dst_off + 1, T(0x55));
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            src[r * cols + c] = T(r * 1000003 + c * 7 + 1);
+            expected[c * rows + r] = src[r * cols + c];
+        }
+    }
+
+    simdpp::transpose_matrix(src.data(), rows, cols, dst.data() + dst_off);
+    TEST_EQUAL_MEMORY(tr, dst.data() + dst_off, expected.data(), rows * cols);
+    TEST_EQUAL(tr, dst[rows * cols + dst_off], T(0x55));
+}
+
+template<class T>
+void test_transpose_type(TestReporter& tr)
+{
+    // sizes around multiples of the block and the tile size
+    const std::size_t sizes[] = { 0, 1, 2, 3, 4, 7, 8, 15, 16, 17, 33, 64, 65, 130 };
+    for (std::size_t rows : sizes) {
+        for (std::size_t cols : sizes) {
+            test_transpose_size<T>(tr, rows, cols, 0);
+        }
+        test_transpose_size<T>(tr, rows, 37, 1);
+    }
+
+    // large enough for streaming stores, both aligned and unaligned output
+    std::size_t n = (std::size_t(1) << 22) / sizeof(T) / 512 + 16;
+    test_transpose_size<T>(tr, 512, n, 0);
+    test_transpose_size<T>(tr, 512, n, 1);
+}
+
+void test_algorithm_transpose(TestReporter& tr)
+{
+    test_transpose_type<uint8_t>(tr);
+    test_transpose_type<uint16_t>(tr);
+    test_transpose_type<uint32_t>(tr);
+    test_transpose_type<uint64_t>(tr);
+    test_transpose_type<float>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
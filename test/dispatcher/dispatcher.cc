@@ -16,6 +16,11 @@ simdpp::Arch test_dispatcher_get_arch()
     return simdpp::this_compile_arch();
 }
 
+simdpp::Arch test_dispatcher_get_arch_light()
+{
+    return simdpp::this_compile_arch();
+}
+
 int test_dispatcher1(int arg)
 {
     return arg;
@@ -240,9 +245,44 @@ std::pair<T, U> test_dispatcher_ret_template2_nondeductible()
     return std::pair<T, U>(sizeof(T), sizeof(U));
 }
 
+simdpp::Arch get_arch(test_dispatcher_class&)
+{
+    return simdpp::this_compile_arch();
+}
+
+int ret1(test_dispatcher_class& self, int arg)
+{
+    return self.value + arg;
+}
+
+void void2(test_dispatcher_class& self, int arg, int arg2)
+{
+    self.value = arg + arg2;
+}
+
+int const_ret1(const test_dispatcher_class& self, int arg)
+{
+    return self.value + arg;
+}
+
+template<class T>
+std::pair<T, T> ret_template_pair(test_dispatcher_class& self,
+                                  const std::pair<T, T>& pair)
+{
+    return std::make_pair(T(pair.first + self.value), T(pair.second + self.value));
+}
+
+template<class T>
+T const_ret_template_nondeductible(const test_dispatcher_class& self)
+{
+    return T(self.value + sizeof(T));
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 
 SIMDPP_MAKE_DISPATCHER_RET0(test_dispatcher_get_arch, simdpp::Arch)
+SIMDPP_MAKE_DISPATCHER_POLICY(LIGHT,
+                              (simdpp::Arch)(test_dispatcher_get_arch_light)())
 SIMDPP_MAKE_DISPATCHER_RET0(test_dispatcher_old_ret0, int)
 SIMDPP_MAKE_DISPATCHER_RET1(test_dispatcher_old_ret1, int, int)
 SIMDPP_MAKE_DISPATCHER_RET2(test_dispatcher_old_ret2, int, int, int)
@@ -442,3 +482,40 @@ SIMDPP_INSTANTIATE_DISPATCHER(
     (template std::pair<int, int>
         test_dispatcher_ret_template2_nondeductible<int, int>())
 )
+
+SIMDPP_MAKE_DISPATCH_TABLE(test_dispatcher_table, get_test_dispatcher_table,
+                           (test_dispatcher_get_arch)(test_dispatcher_ret1)
+                           (test_dispatcher_ret2)(test_dispatcher_void1))
+
+SIMDPP_MAKE_MEMBER_DISPATCHER((test_dispatcher_class)(simdpp::Arch)(get_arch)())
+SIMDPP_MAKE_MEMBER_DISPATCHER((test_dispatcher_class)(int)(ret1)((int) arg))
+SIMDPP_MAKE_MEMBER_DISPATCHER((test_dispatcher_class)(void)(void2)
+                              ((int) arg, (int) arg2))
+SIMDPP_MAKE_CONST_MEMBER_DISPATCHER((test_dispatcher_class)(int)(const_ret1)
+                                    ((int) arg))
+
+SIMDPP_MAKE_MEMBER_DISPATCHER((template<class T>) (<T>)
+                              (test_dispatcher_class) (std::pair<T, T>)
+                              (ret_template_pair) ((const std::pair<T, T>&) pair))
+
+SIMDPP_INSTANTIATE_MEMBER_DISPATCHER(
+    ((template std::pair<int, int>
+        test_dispatcher_class::ret_template_pair<int>(const std::pair<int, int>& pair)),
+     (template std::pair<char, char>
+        test_dispatcher_class::ret_template_pair<char>(const std::pair<char, char>& pair))),
+    ((template std::pair<int, int>
+        ret_template_pair<int>(test_dispatcher_class&, const std::pair<int, int>& pair)),
+     (template std::pair<char, char>
+        ret_template_pair<char>(test_dispatcher_class&, const std::pair<char, char>& pair)))
+)
+
+SIMDPP_MAKE_CONST_MEMBER_DISPATCHER((template<class T>) (<T>)
+                                    (test_dispatcher_class) (T)
+                                    (const_ret_template_nondeductible) ())
+
+SIMDPP_INSTANTIATE_MEMBER_DISPATCHER(
+    ((template int test_dispatcher_class::const_ret_template_nondeductible<int>() const),
+     (template char test_dispatcher_class::const_ret_template_nondeductible<char>() const)),
+    ((template int const_ret_template_nondeductible<int>(const test_dispatcher_class&)),
+     (template char const_ret_template_nondeductible<char>(const test_dispatcher_class&)))
+)
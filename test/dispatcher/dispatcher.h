@@ -10,6 +10,7 @@
 
 simdpp::Arch get_supported_arch(); // in main_dispatcher.cc
 simdpp::Arch test_dispatcher_get_arch();
+simdpp::Arch test_dispatcher_get_arch_light();
 
 extern int g_test_dispatcher_val;
 int test_dispatcher_old_ret0();
@@ -79,3 +80,26 @@ template<class T>
 std::pair<T, T> test_dispatcher_ret_template_nondeductible();
 template<class T, class U>
 std::pair<T, U> test_dispatcher_ret_template2_nondeductible();
+
+struct test_dispatcher_table {
+    simdpp::Arch (*test_dispatcher_get_arch)();
+    int (*test_dispatcher_ret1)(int arg);
+    int (*test_dispatcher_ret2)(int arg, int arg2);
+    void (*test_dispatcher_void1)(int arg);
+};
+
+const test_dispatcher_table* get_test_dispatcher_table();
+
+struct test_dispatcher_class {
+    int value;
+
+    simdpp::Arch get_arch();
+    int ret1(int arg);
+    void void2(int arg, int arg2);
+    int const_ret1(int arg) const;
+
+    template<class T>
+    std::pair<T, T> ret_template_pair(const std::pair<T, T>& pair);
+    template<class T>
+    T const_ret_template_nondeductible() const;
+};
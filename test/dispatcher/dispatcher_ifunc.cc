@@ -0,0 +1,67 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "dispatcher_ifunc.h"
+#include <simdpp/simd.h>
+
+// The test is meaningless if the regular dispatchers are used
+#if SIMDPP_EMIT_DISPATCHER && !SIMDPP_DETAIL_DISPATCH_IFUNC
+#error "The dispatchers are not implemented as GNU indirect functions"
+#endif
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+simdpp::Arch test_dispatcher_ifunc_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+simdpp::Arch test_dispatcher_ifunc_get_arch_light()
+{
+    return simdpp::this_compile_arch();
+}
+
+int test_dispatcher_ifunc_ret2(int arg, int arg2)
+{
+    return arg + arg2;
+}
+
+namespace {
+
+struct RegisterArch {
+    RegisterArch()
+    {
+        test_dispatcher_ifunc_register_arch(simdpp::this_compile_arch());
+    }
+} g_register_arch;
+
+} // namespace
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+#if SIMDPP_EMIT_DISPATCHER
+static std::vector<simdpp::Arch>& get_compiled_archs()
+{
+    static std::vector<simdpp::Arch> archs;
+    return archs;
+}
+
+const std::vector<simdpp::Arch>& test_dispatcher_ifunc_compiled_archs()
+{
+    return get_compiled_archs();
+}
+
+void test_dispatcher_ifunc_register_arch(simdpp::Arch arch)
+{
+    get_compiled_archs().push_back(arch);
+}
+#endif
+
+SIMDPP_MAKE_DISPATCHER((simdpp::Arch)(test_dispatcher_ifunc_get_arch)())
+SIMDPP_MAKE_DISPATCHER_POLICY(LIGHT,
+                              (simdpp::Arch)(test_dispatcher_ifunc_get_arch_light)())
+SIMDPP_MAKE_DISPATCHER((int)(test_dispatcher_ifunc_ret2)((int) arg, (int) arg2))
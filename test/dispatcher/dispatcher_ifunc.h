@@ -0,0 +1,18 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/dispatch/arch.h>
+#include <vector>
+
+// The architectures of all compiled versions. Filled by static initializers,
+// independently of the dispatchers.
+const std::vector<simdpp::Arch>& test_dispatcher_ifunc_compiled_archs();
+void test_dispatcher_ifunc_register_arch(simdpp::Arch arch);
+
+simdpp::Arch test_dispatcher_ifunc_get_arch();
+simdpp::Arch test_dispatcher_ifunc_get_arch_light();
+int test_dispatcher_ifunc_ret2(int arg, int arg2);
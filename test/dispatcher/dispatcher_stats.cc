@@ -0,0 +1,11 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// The dispatcher tests compiled with SIMDPP_DISPATCH_STATS enabled. A separate
+// file is needed because simdpp_multiarch names the copies of the source file
+// after the original one.
+#include "dispatcher.cc"
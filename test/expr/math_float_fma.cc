@@ -0,0 +1,123 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define SIMDPP_EXPR_FUSE_FMA 1
+#include <simdpp/simd.h>
+#include "../utils/test_results_set.h"
+#include "../utils/test_helpers.h"
+#include "../common/vectors.h"
+#include <type_traits>
+
+#if SIMDPP_EXPR_FUSE_FMA && SIMDPP_DETAIL_HAS_FMA
+
+template<class V, unsigned B>
+void test_expr_math_float_fma_v(TestReporter& ts)
+{
+    SIMDPP_ARCH_NAMESPACE::Vectors<B,16> v;
+
+    using namespace simdpp;
+
+    for (unsigned i = 0; i < 4; ++i) {
+        V a = load(v.pu8+(i*4+0)*B);
+        V b = load(v.pu8+(i*4+1)*B);
+        V c = load(v.pu8+(i*4+2)*B);
+        V d = load(v.pu8+(i*4+3)*B);
+
+        // products are evaluated as vectors when not fused
+        TEST_EQUAL(ts, mul(a, b), V(a * b));
+        TEST_EQUAL(ts, mul(mul(a, b), c), V(a * b * c));
+        TEST_EQUAL(ts, add(mul(a, b), c), add(V(a * b), c));
+        TEST_EQUAL(ts, add(mul(a, b), c), add((a * b).eval(), c));
+
+        // fused operations
+        TEST_EQUAL(ts, fmadd(a, b, c), V(a * b + c));
+        TEST_EQUAL(ts, fmadd(a, b, c), V(c + a * b));
+        TEST_EQUAL(ts, fmsub(a, b, c), V(a * b - c));
+        TEST_EQUAL(ts, fmadd(neg(a), b, c), V(c - a * b));
+        TEST_EQUAL(ts, fmadd(a, b, mul(c, d)), V(a * b + c * d));
+        TEST_EQUAL(ts, fmsub(a, b, mul(c, d)), V(a * b - c * d));
+        TEST_EQUAL(ts, fmadd(fmadd(a, b, c), d, a), V((a * b + c) * d + a));
+        TEST_EQUAL(ts, fmadd(mul(a, b), c, d), V(a * b * c + d));
+        TEST_EQUAL(ts, fmadd(mul(a, b), mul(c, d), a), V(a * b * (c * d) + a));
+
+        // the assigned vectors are not changed by fusing
+        auto p = a * b;
+        p = p + c;
+        TEST_EQUAL(ts, fmadd(a, b, c), V(p));
+        TEST_EQUAL(ts, add(fmadd(a, b, c), d), V(p + d));
+        TEST_EQUAL(ts, fmsub(fmadd(a, b, c), make_float<V>(1), d), V(p - d));
+
+        // scalar arguments
+        TEST_EQUAL(ts, fmadd(a, b, make_float<V>(1.5f)), V(a * b + 1.5f));
+        TEST_EQUAL(ts, fmadd(a, b, make_float<V>(1.5)), V(1.5 + a * b));
+        TEST_EQUAL(ts, fmsub(a, b, make_float<V>(1.5f)), V(a * b - 1.5f));
+        TEST_EQUAL(ts, fmadd(neg(a), b, make_float<V>(1.5)), V(1.5 - a * b));
+        TEST_EQUAL(ts, fmadd(a, b, make_float<V>(1)), V(a * b + 1));
+        TEST_EQUAL(ts, fmsub(a, b, make_float<V>(2u)), V(a * b - 2u));
+        TEST_EQUAL(ts, fmadd(neg(a), b, make_float<V>(3)), V(3 - a * b));
+
+        // products with scalars
+        TEST_EQUAL(ts, fmadd(make_float<V>(2.0f), a, c), V(2.0f * a + c));
+        TEST_EQUAL(ts, fmadd(a, make_float<V>(2.0), c), V(c + a * 2.0));
+        TEST_EQUAL(ts, fmsub(make_float<V>(2), a, c), V(2 * a - c));
+        TEST_EQUAL(ts, fmadd(neg(a), make_float<V>(2), c), V(c - a * 2));
+        TEST_EQUAL(ts, fmadd(make_float<V>(2), a, make_float<V>(1)), V(2 * a + 1));
+        TEST_EQUAL(ts, fmadd(mul(a, b), make_float<V>(2), c), V(a * b * 2 + c));
+        TEST_EQUAL(ts, fmadd(make_float<V>(2.0f), mul(a, b), c), V(2.0f * (a * b) + c));
+    }
+}
+
+// The products can't be modified through references to vectors, which would
+// leave the operands that are fused out of date
+static_assert(!std::is_convertible<simdpp::expr_fmul<simdpp::float32<4>>&,
+                                   simdpp::float32<4>&>::value,
+              "The products must not be modifiable as vectors");
+
+void test_expr_math_float_fma_transpose(TestReporter& ts)
+{
+    SIMDPP_ARCH_NAMESPACE::Vectors<16,16> v;
+
+    using namespace simdpp;
+    using V = float32<4>;
+
+    V a = load(v.pu8);
+    V b = load(v.pu8+16);
+    V c = load(v.pu8+32);
+
+    // the products are modified after they are converted to vectors
+    V p0 = a * b, p1 = b * c, p2 = c * a, p3 = a * a;
+    V r0 = mul(a, b), r1 = mul(b, c), r2 = mul(c, a), r3 = mul(a, a);
+    transpose4(p0, p1, p2, p3);
+    transpose4(r0, r1, r2, r3);
+    TEST_EQUAL(ts, add(r0, c), V(p0 + c));
+    TEST_EQUAL(ts, add(r3, c), V(c + p3));
+
+    auto p = a * b;
+    V q = p;
+    transpose4(q, p0, p1, p2);
+    p = q;
+    TEST_EQUAL(ts, add(q, c), V(p + c));
+}
+
+void test_expr_math_float_fma(TestReporter& ts)
+{
+    using namespace simdpp;
+
+    test_expr_math_float_fma_transpose(ts);
+
+    test_expr_math_float_fma_v<float32<4>, 16>(ts);
+    test_expr_math_float_fma_v<float64<2>, 16>(ts);
+    test_expr_math_float_fma_v<float32<8>, 32>(ts);
+}
+
+#else
+
+void test_expr_math_float_fma(TestReporter&)
+{
+}
+
+#endif
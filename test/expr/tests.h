@@ -13,6 +13,7 @@
 void main_test_function(TestReporter& ts);
 void test_expr_bitwise(TestReporter& ts);
 void test_expr_math_float(TestReporter& ts);
+void test_expr_math_float_fma(TestReporter& ts);
 void test_expr_math_int(TestReporter& ts);
 void test_expr_compare(TestReporter& tr);
 void test_algorithm_bitonic_sort(TestReporter& tr);
@@ -223,6 +223,8 @@ void test_math_int64_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, sub, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, add, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, sub, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, clmul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, clmul_hi, s);
 
 #if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, min, s);
@@ -328,6 +330,27 @@ void test_math_int(TestResults& res)
 
         TEST_PUSH_ALL_COMB_OP2(tc, uint8x16, div_p<4>, s3);
     }
+    { // reduce_mul of vectors spanning several native vectors
+        // the products of even values are zero, thus mostly odd values
+        TestData<uint16<64>> s;
+        s.add(make_uint(0x0001, 0x0003, 0x0005, 0x0007));
+        s.add(make_uint(0x0009, 0x0001, 0x0001, 0x0001));
+        s.add(make_uint(0xffff, 0xfffd, 0xfffb, 0xfff9));
+        s.add(make_uint(0x7fff, 0x8001, 0x0001, 0x0003));
+        s.add(make_uint(0x0001, 0x0001, 0x0002, 0x0001));
+
+        TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint16<64>, reduce_mul, s);
+        TEST_PUSH_ALL_COMB_OP1_T(tc, int32_t, int16<64>, reduce_mul, s);
+
+        TestData<uint32<32>> s2;
+        s2.add(make_uint(0x00000001, 0x00000003, 0x00000005, 0x00000007));
+        s2.add(make_uint(0x00000009, 0x00000001, 0x00000001, 0x00000001));
+        s2.add(make_uint(0xffffffff, 0xfffffffd, 0x12345679, 0x00010001));
+        s2.add(make_uint(0x7fffffff, 0x80000001, 0x00000001, 0x00000003));
+        s2.add(make_uint(0x00000001, 0x00000001, 0x00000002, 0x00000001));
+
+        TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint32<32>, reduce_mul, s2);
+    }
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -73,7 +73,19 @@ void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& o
 
     test_for_each(res, tr);
 
+    test_algorithm_binary_search(tr);
     test_algorithm_bitonic_sort(tr);
+    test_algorithm_blocked_bloom(tr);
+    test_algorithm_crc32(tr);
+    test_algorithm_filter2d(tr);
+    test_algorithm_fir(tr);
+    test_algorithm_gemm(tr);
+    test_algorithm_hash(tr);
+    test_algorithm_reduce(tr);
+    test_algorithm_set_operations(tr);
+    test_algorithm_soa(tr);
+    test_algorithm_transform(tr);
+    test_algorithm_transpose(tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -37,7 +37,19 @@ void test_permute_generic(TestResults& res);
 void test_shuffle_transpose(TestResults& res);
 void test_test_utils(TestResults& res);
 void test_transpose(TestResults& res);
+void test_algorithm_binary_search(TestReporter& tr);
 void test_algorithm_bitonic_sort(TestReporter& tr);
+void test_algorithm_blocked_bloom(TestReporter& tr);
+void test_algorithm_crc32(TestReporter& tr);
+void test_algorithm_filter2d(TestReporter& tr);
+void test_algorithm_fir(TestReporter& tr);
+void test_algorithm_gemm(TestReporter& tr);
+void test_algorithm_hash(TestReporter& tr);
+void test_algorithm_reduce(TestReporter& tr);
+void test_algorithm_set_operations(TestReporter& tr);
+void test_algorithm_soa(TestReporter& tr);
+void test_algorithm_transform(TestReporter& tr);
+void test_algorithm_transpose(TestReporter& tr);
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 
@@ -8,7 +8,9 @@
 #include "dispatcher/dispatcher.h"
 #include <algorithm>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 #include <cstdlib>
 #include "utils/test_helpers.h"
 
@@ -18,6 +20,7 @@
 #include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
 #include <simdpp/dispatch/get_arch_raw_cpuid.h>
 #include <simdpp/dispatch/get_arch_string_list.h>
+#include <simdpp/dispatch/get_cache_info.h>
 
 static simdpp::Arch g_supported_arch;
 
@@ -91,66 +94,247 @@ void test_dispatcher_template2_pair_for_type(TestReporter& tr)
     TEST_EQUAL(tr, (U)(sizeof(U)), pair.second);
 }
 
-int main(int argc, char** argv)
+template<class T>
+void test_dispatcher_member_template_for_type(TestReporter& tr)
 {
-    using simdpp::Arch;
+    test_dispatcher_class obj;
+    obj.value = 10;
 
-    if (argc != 2) {
-        std::cerr << "Wrong number of arguments. Please supply the name of \n"
-                     "the architecture as the first argument.";
-        return EXIT_FAILURE;
-    }
+    std::pair<T, T> pair = obj.ret_template_pair(std::pair<T, T>(1, 2));
+    TEST_EQUAL(tr, (T)(10+1), pair.first);
+    TEST_EQUAL(tr, (T)(10+2), pair.second);
 
-    std::string arch_name = argv[1];
+    const test_dispatcher_class& cobj = obj;
+    TEST_EQUAL(tr, (T)(10+sizeof(T)), cobj.const_ret_template_nondeductible<T>());
+}
+
+bool parse_arch_name(const std::string& arch_name, simdpp::Arch& arch)
+{
+    using simdpp::Arch;
     if (arch_name == "NONE_NULL") {
-        g_supported_arch = Arch::NONE_NULL;
+        arch = Arch::NONE_NULL;
     } else if (arch_name == "X86_SSE2") {
-        g_supported_arch = Arch::X86_SSE2;
+        arch = Arch::X86_SSE2;
     } else if (arch_name == "X86_SSE3") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3;
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3;
     } else if (arch_name == "X86_SSSE3") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3;
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3;
     } else if (arch_name == "X86_SSE4_1") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                           Arch::X86_SSE4_1;
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                Arch::X86_SSE4_1;
     } else if (arch_name == "X86_AVX") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                 Arch::X86_SSE4_1 | Arch::X86_AVX;
     } else if (arch_name == "X86_AVX2") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                 Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2;
     } else if (arch_name == "X86_AVX512F") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                 Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F;
     } else if (arch_name == "X86_AVX512BW") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                 Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F | Arch::X86_AVX512BW;
     } else if (arch_name == "X86_AVX512DQ") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                 Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F | Arch::X86_AVX512DQ;
     } else if (arch_name == "X86_AVX512VL") {
-        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+        arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                 Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
                 Arch::X86_AVX512F | Arch::X86_AVX512VL;
+    } else if (arch_name == "X86_FMA3") {
+        arch = Arch::X86_FMA3;
+    } else if (arch_name == "X86_POPCNT_INSN") {
+        arch = Arch::X86_POPCNT_INSN;
+    } else if (arch_name == "X86_PCLMULQDQ") {
+        arch = Arch::X86_PCLMULQDQ;
+    } else if (arch_name == "X86_VPCLMULQDQ") {
+        arch = Arch::X86_VPCLMULQDQ;
+    } else if (arch_name == "X86_BMI1") {
+        arch = Arch::X86_BMI1;
+    } else if (arch_name == "X86_BMI2") {
+        arch = Arch::X86_BMI2;
+    } else if (arch_name == "X86_F16C") {
+        arch = Arch::X86_F16C;
+    } else if (arch_name == "X86_AVX512VBMI") {
+        arch = Arch::X86_AVX512VBMI;
+    } else if (arch_name == "X86_AVX512VBMI2") {
+        arch = Arch::X86_AVX512VBMI2;
+    } else if (arch_name == "X86_AVX512VNNI") {
+        arch = Arch::X86_AVX512VNNI;
+    } else if (arch_name == "X86_AVX512BITALG") {
+        arch = Arch::X86_AVX512BITALG;
+    } else if (arch_name == "X86_AVX512VPOPCNTDQ") {
+        arch = Arch::X86_AVX512VPOPCNTDQ;
+    } else if (arch_name == "X86_AVX512BF16") {
+        arch = Arch::X86_AVX512BF16;
+    } else if (arch_name == "X86_AVX512FP16") {
+        arch = Arch::X86_AVX512FP16;
+    } else if (arch_name == "X86_AVXVNNI") {
+        arch = Arch::X86_AVXVNNI;
+    } else if (arch_name == "X86_GFNI") {
+        arch = Arch::X86_GFNI;
     } else if (arch_name == "ARM_NEON") {
-        g_supported_arch = Arch::ARM_NEON;
+        arch = Arch::ARM_NEON;
     } else if (arch_name == "ARM_NEON_FLT_SP") {
-        g_supported_arch = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP;
+        arch = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP;
     } else {
-        std::cerr << "Invalid architecture specified: " << arch_name << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Parses a comma separated list of architecture names, in the same format as
+// the architecture definitions passed to simdpp_multiarch
+bool parse_arch(const std::string& arch_names, simdpp::Arch& arch)
+{
+    arch = simdpp::Arch::NONE_NULL;
+    std::size_t begin = 0;
+    while (true) {
+        std::size_t end = arch_names.find(',', begin);
+        simdpp::Arch name_arch;
+        if (!parse_arch_name(arch_names.substr(begin, end - begin), name_arch)) {
+            return false;
+        }
+        arch |= name_arch;
+        if (end == std::string::npos) {
+            return true;
+        }
+        begin = end + 1;
+    }
+}
+
+void test_dispatch_policy(TestReporter& tr)
+{
+    using simdpp::Arch;
+    using simdpp::DispatchPolicy;
+    using simdpp::detail::FnVersion;
+    using simdpp::detail::select_version_any;
+
+    FnVersion versions[3] = {};
+    versions[0].needed_arch = Arch::NONE_NULL;
+    versions[0].fun_ptr = reinterpret_cast<simdpp::detail::VoidFunPtr>(&get_supported_arch);
+    versions[1] = versions[0];
+    versions[1].needed_arch = Arch::X86_SSE2 | Arch::X86_AVX | Arch::X86_AVX2;
+    versions[2] = versions[0];
+    versions[2].needed_arch = versions[1].needed_arch | Arch::X86_AVX512F;
+
+    Arch all = versions[2].needed_arch;
+    unsigned best = static_cast<unsigned>(versions[2].needed_arch);
+    unsigned light = static_cast<unsigned>(versions[1].needed_arch);
+    TEST_EQUAL(tr, best, static_cast<unsigned>(
+        select_version_any(versions, 3, all).needed_arch));
+    TEST_EQUAL(tr, light, static_cast<unsigned>(
+        select_version_any(versions, 3, all, DispatchPolicy::LIGHT).needed_arch));
+
+    // falls back to the best version if all need AVX-512
+    TEST_EQUAL(tr, best, static_cast<unsigned>(
+        select_version_any(versions + 2, 1, all, DispatchPolicy::LIGHT).needed_arch));
+}
+
+// Checks that the version for @a better_name is selected over the version for
+// @a worse_name when both are supported, regardless of their order
+void test_dispatch_rank(TestReporter& tr, const char* better_name,
+                        const char* worse_name)
+{
+    using simdpp::Arch;
+    using simdpp::detail::FnVersion;
+    using simdpp::detail::select_version_any;
+
+    FnVersion versions[3] = {};
+    versions[0].fun_ptr = reinterpret_cast<simdpp::detail::VoidFunPtr>(&get_supported_arch);
+    versions[1] = versions[0];
+    versions[2] = versions[0];
+    versions[0].needed_arch = Arch::NONE_NULL;
+    TEST_EQUAL(tr, true, parse_arch(better_name, versions[1].needed_arch));
+    TEST_EQUAL(tr, true, parse_arch(worse_name, versions[2].needed_arch));
+
+    Arch all = versions[1].needed_arch | versions[2].needed_arch;
+    unsigned better = static_cast<unsigned>(versions[1].needed_arch);
+    TEST_EQUAL(tr, better, static_cast<unsigned>(
+        select_version_any(versions, 3, all).needed_arch));
+    std::swap(versions[1], versions[2]);
+    TEST_EQUAL(tr, better, static_cast<unsigned>(
+        select_version_any(versions, 3, all).needed_arch));
+}
+
+void test_dispatch_rank(TestReporter& tr)
+{
+    // the auxiliary instruction sets don't outrank the base ones
+    test_dispatch_rank(tr, "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN",
+                       "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_PCLMULQDQ");
+    // the configs with more auxiliary instruction sets are preferred
+    test_dispatch_rank(tr, "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_PCLMULQDQ",
+                       "X86_AVX2,X86_FMA3,X86_POPCNT_INSN");
+    test_dispatch_rank(tr, "X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_FMA3,X86_POPCNT_INSN",
+                       "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_PCLMULQDQ");
+    test_dispatch_rank(tr, "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN",
+                       "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_BMI2");
+    test_dispatch_rank(tr, "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN",
+                       "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_F16C");
+    test_dispatch_rank(tr, "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN",
+                       "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_PCLMULQDQ,X86_VPCLMULQDQ,"
+                       "X86_BMI1,X86_BMI2,X86_F16C,X86_AVXVNNI,X86_GFNI");
+    test_dispatch_rank(tr, "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512VBMI,X86_GFNI",
+                       "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_BMI2");
+}
+
+void test_cache_info(TestReporter& tr)
+{
+    simdpp::CacheInfo info = simdpp::get_cache_info();
+    simdpp::CacheInfo info2 = simdpp::get_cache_info();
+    TEST_EQUAL(tr, info.l1d_size, info2.l1d_size);
+    TEST_EQUAL(tr, info.l2_size, info2.l2_size);
+    TEST_EQUAL(tr, info.l3_size, info2.l3_size);
+    TEST_EQUAL(tr, info.line_size, info2.line_size);
+
+    // the values are either unknown or plausible
+    TEST_EQUAL(tr, info.line_size & (info.line_size - 1), std::size_t(0));
+    if (info.l1d_size != 0 && info.l2_size != 0) {
+        TEST_EQUAL(tr, info.l1d_size <= info.l2_size, true);
+    }
+    if (info.l1d_size != 0 && info.line_size != 0) {
+        TEST_EQUAL(tr, info.l1d_size % info.line_size, std::size_t(0));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using simdpp::Arch;
+
+    if (argc != 2 && argc != 3) {
+        std::cerr << "Wrong number of arguments. Please supply the name of \n"
+                     "the architecture as the first argument and optionally \n"
+                     "the name of the expected architecture as the second.";
+        return EXIT_FAILURE;
+    }
+
+    if (!parse_arch(argv[1], g_supported_arch)) {
+        std::cerr << "Invalid architecture specified: " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+    // The architecture that is expected to be selected. Differs from the
+    // supported architecture if SIMDPP_FORCE_ARCH or SIMDPP_MAX_ARCH is set.
+    Arch expected_arch = g_supported_arch;
+    if (argc == 3 && !parse_arch(argv[2], expected_arch)) {
+        std::cerr << "Invalid architecture specified: " << argv[2] << "\n";
         return EXIT_FAILURE;
     }
 
     TestReporter tr(std::cerr);
 
+    // resolve all dispatchers eagerly. The dispatchers use the cached
+    // architecture afterwards.
+    simdpp::dispatch_init_all();
+    simdpp::dispatch_init_all();
+
     Arch selected = test_dispatcher_get_arch();
-    if (selected != g_supported_arch) {
+    if (selected != expected_arch) {
         tr.out() << "Wrong architecture selected: \n"
-                 << "  Supported: "
-                 << std::hex << static_cast<unsigned>(g_supported_arch)
+                 << "  Expected: "
+                 << std::hex << static_cast<unsigned>(expected_arch)
                  << "\n  Selected: "
                  << std::hex << static_cast<unsigned>(selected) << "\n";
         tr.add_result(false);
@@ -158,6 +342,26 @@ int main(int argc, char** argv)
     }
     tr.add_result(true);
 
+    // the light dispatcher doesn't select AVX-512 versions, otherwise
+    // it's equivalent to the regular one
+    Arch avx512 = Arch::X86_AVX512F | Arch::X86_AVX512BW |
+                  Arch::X86_AVX512DQ | Arch::X86_AVX512VL |
+                  Arch::X86_AVX512VBMI | Arch::X86_AVX512VBMI2 |
+                  Arch::X86_AVX512VNNI | Arch::X86_AVX512BITALG |
+                  Arch::X86_AVX512VPOPCNTDQ | Arch::X86_AVX512BF16 |
+                  Arch::X86_AVX512FP16;
+    Arch selected_light = test_dispatcher_get_arch_light();
+    if ((expected_arch & avx512) == Arch::NONE_NULL) {
+        TEST_EQUAL(tr, static_cast<unsigned>(expected_arch),
+                   static_cast<unsigned>(selected_light));
+    } else {
+        TEST_EQUAL(tr, static_cast<unsigned>(Arch::NONE_NULL),
+                   static_cast<unsigned>(selected_light & avx512));
+    }
+    test_dispatch_policy(tr);
+    test_dispatch_rank(tr);
+    test_cache_info(tr);
+
     TEST_EQUAL(tr, 42, test_dispatcher_old_ret0());
     TEST_EQUAL(tr, 1, test_dispatcher_old_ret1(1));
     TEST_EQUAL(tr, 1+2, test_dispatcher_old_ret2(1, 2));
@@ -233,12 +437,68 @@ int main(int argc, char** argv)
     TEST_EQUAL(tr, 1+3, intpair.first);
     TEST_EQUAL(tr, 2+4, intpair.second);
 
+    // all dispatchers have been resolved by dispatch_init_all()
+    std::vector<simdpp::DispatcherInfo> infos = simdpp::get_dispatcher_info();
+    bool found = false;
+    for (const auto& info : infos) {
+        TEST_EQUAL(tr, true, info.selected >= 0);
+#if SIMDPP_DISPATCH_STATS
+        // the calls are attributed to the selected version
+        if (std::string(info.name) == "test_dispatcher_ret1" && info.selected >= 0) {
+            std::uint64_t total = 0;
+            for (const auto& version : info.versions) {
+                total += version.calls;
+            }
+            TEST_EQUAL(tr, std::uint64_t(1), info.versions[info.selected].calls);
+            TEST_EQUAL(tr, std::uint64_t(1), total);
+        }
+#endif
+        if (std::string(info.name) != "test_dispatcher_get_arch") {
+            continue;
+        }
+        found = true;
+        if (info.selected >= 0) {
+            TEST_EQUAL(tr, static_cast<unsigned>(expected_arch),
+                       static_cast<unsigned>(info.versions[info.selected].needed_arch));
+        }
+    }
+    TEST_EQUAL(tr, true, found);
+
+#if SIMDPP_DISPATCH_STATS
+    std::ostringstream stats;
+    simdpp::dump_dispatch_stats(stats);
+    TEST_EQUAL(tr, true, stats.str().find("test_dispatcher_ret2 ") != std::string::npos);
+    TEST_EQUAL(tr, true, stats.str().find("test_dispatcher_ret_voidptr ") != std::string::npos);
+#endif
+
+    const test_dispatcher_table* table = get_test_dispatcher_table();
+    TEST_EQUAL(tr, table, get_test_dispatcher_table());
+    TEST_EQUAL(tr, static_cast<unsigned>(expected_arch),
+               static_cast<unsigned>(table->test_dispatcher_get_arch()));
+    TEST_EQUAL(tr, 1, table->test_dispatcher_ret1(1));
+    TEST_EQUAL(tr, 1+2, table->test_dispatcher_ret2(1, 2));
+    g_test_dispatcher_val = 0;
+    table->test_dispatcher_void1(1);
+    TEST_EQUAL(tr, 1, g_test_dispatcher_val);
+
+    test_dispatcher_class obj;
+    obj.value = 10;
+    TEST_EQUAL(tr, static_cast<unsigned>(expected_arch),
+               static_cast<unsigned>(obj.get_arch()));
+    TEST_EQUAL(tr, 10+1, obj.ret1(1));
+    obj.void2(1, 2);
+    TEST_EQUAL(tr, 1+2, obj.value);
+    const test_dispatcher_class& cobj = obj;
+    TEST_EQUAL(tr, 1+2+4, cobj.const_ret1(4));
+
     test_dispatcher_template_pair_for_type<int>(tr);
     test_dispatcher_template_pair_for_type<char>(tr);
     test_dispatcher_template2_pair_for_type<int, int>(tr);
     test_dispatcher_template2_pair_for_type<char, int>(tr);
     test_dispatcher_template2_pair_for_type<int, char>(tr);
     test_dispatcher_template2_pair_for_type<char, char>(tr);
+    test_dispatcher_member_template_for_type<int>(tr);
+    test_dispatcher_member_template_for_type<char>(tr);
 
     tr.report_summary();
     return tr.success() ? EXIT_SUCCESS : EXIT_FAILURE;
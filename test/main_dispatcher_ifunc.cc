@@ -0,0 +1,66 @@
+/*  Copyright (C) 2026  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "dispatcher/dispatcher_ifunc.h"
+#include <iostream>
+#include <cstdlib>
+#include "utils/test_helpers.h"
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+
+// Returns the architecture of the compiled version that a dispatcher with the
+// given policy is expected to select on the current CPU
+simdpp::Arch get_expected_arch(bool light)
+{
+    using simdpp::Arch;
+    Arch avx512 = Arch::X86_AVX512F | Arch::X86_AVX512BW |
+                  Arch::X86_AVX512DQ | Arch::X86_AVX512VL |
+                  Arch::X86_AVX512VBMI | Arch::X86_AVX512VBMI2 |
+                  Arch::X86_AVX512VNNI | Arch::X86_AVX512BITALG |
+                  Arch::X86_AVX512VPOPCNTDQ | Arch::X86_AVX512BF16 |
+                  Arch::X86_AVX512FP16;
+
+    Arch cpu = simdpp::get_arch_raw_cpuid();
+    bool found = false;
+    bool found_light = false;
+    Arch best = Arch::NONE_NULL;
+    Arch best_light = Arch::NONE_NULL;
+    for (Arch arch : test_dispatcher_ifunc_compiled_archs()) {
+        if (!simdpp::test_arch_subset(cpu, arch)) {
+            continue;
+        }
+        if (!found || arch > best) {
+            best = arch;
+            found = true;
+        }
+        if ((arch & avx512) == Arch::NONE_NULL &&
+            (!found_light || arch > best_light)) {
+            best_light = arch;
+            found_light = true;
+        }
+    }
+    // the light policy falls back to the best version if all versions need
+    // AVX-512
+    return (light && found_light) ? best_light : best;
+}
+
+int main()
+{
+    TestReporter tr(std::cerr);
+
+    // The dispatchers are resolved by the dynamic loader before main runs,
+    // both when they are linked into the executable and when they are in a
+    // shared library
+    TEST_EQUAL(tr, true, !test_dispatcher_ifunc_compiled_archs().empty());
+    TEST_EQUAL(tr, static_cast<unsigned>(get_expected_arch(false)),
+               static_cast<unsigned>(test_dispatcher_ifunc_get_arch()));
+    TEST_EQUAL(tr, static_cast<unsigned>(get_expected_arch(true)),
+               static_cast<unsigned>(test_dispatcher_ifunc_get_arch_light()));
+    TEST_EQUAL(tr, 1+2, test_dispatcher_ifunc_ret2(1, 2));
+
+    tr.report_summary();
+    return tr.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -96,6 +96,76 @@ single_arch_template = '''
     #else
     #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_PCLMULQDQ
+    #define SIMDPP_DISPATCH_$num$_NS_ID_PCLMULQDQ SIMDPP_INSN_ID_PCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_PCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_$num$_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_$num$_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BF16
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512BF16 SIMDPP_INSN_ID_AVX512BF16
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512BF16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512FP16
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512FP16 SIMDPP_INSN_ID_AVX512FP16
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512FP16
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVXVNNI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVXVNNI SIMDPP_INSN_ID_AVXVNNI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVXVNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_GFNI
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_$num$_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -127,7 +197,7 @@ single_arch_template = '''
     #define SIMDPP_DISPATCH_$num$_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_$num$_NAMESPACE SIMDPP_PP_PASTE22(arch,         $n$
+    #define SIMDPP_DISPATCH_$num$_NAMESPACE SIMDPP_PP_PASTE36(arch,         $n$
         SIMDPP_DISPATCH_$num$_NS_ID_NULL,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE2,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE3,                                   $n$
@@ -140,6 +210,20 @@ single_arch_template = '''
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512BW,                               $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512DQ,                               $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512VL,                               $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_PCLMULQDQ,                              $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_VPCLMULQDQ,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_BMI1,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_BMI2,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_F16C,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI2,                            $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512BITALG,                           $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ,                        $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512BF16,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512FP16,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVXVNNI,                                $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_GFNI,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_FMA3,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_FMA4,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_XOP,                                    $n$